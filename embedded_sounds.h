@@ -0,0 +1,1242 @@
+// Generated from sounds/Blip.wav, sounds/Boom.wav and sounds/Shoot.wav: the decoded
+// 16-bit mono 44.1 kHz samples with the RIFF headers stripped. main.cpp builds its
+// Sounds straight from these arrays, so nothing is read from disk at startup.
+// Regenerate with: python3 sounds/embed_sounds.py
+#pragma once
+#include <cstdint>
+
+const unsigned int EMBEDDED_SOUND_RATE = 44100;
+
+const int16_t embeddedBlipPcm[1927] = {
+    0, 22, 33, 72, 91, 144, 168, 195, 219, 140, 154, 69, 75, -105, -113, -312,
+    -332, -397, -419, -495, -520, -384, -401, -124, -130, 103, 107, 501, 519, 703, 727, 725,
+    748, 694, 714, 258, 266, -151, -155, -556, -570, -1029, -1054, -1017, -1040, -910, -929, -554,
+    -566, 187, 191, 643, 656, 1178, 1200, 1444, 1470, 1107, 1126, 795, 808, 0, 0, -849,
+    -862, -1261, -1280, -1754, -1780, -1529, -1551, -892, -905, -278, -282, 877, 888, 1541, 1561, 1847,
+    1871, 2008, 2032, 1166, 1180, 340, 344, -644, -651, -1796, -1816, -2035, -2058, -2306, -2331, -1681,
+    -1698, -497, -502, 389, 393, 1833, 1851, 2410, 2433, 2429, 2452, 2227, 2248, 786, 793, -330,
+    -333, -1150, -1160, -972, -981, -221, -223, 583, 588, 1006, 1014, 1536, 1548, 1419, 1430, 992,
+    1000, 438, 441, -459, -463, -1081, -1089, -1503, -1514, -1577, -1589, -1189, -1197, -531, -535, 301,
+    303, 1018, 1025, 1592, 1603, 1860, 1872, 1459, 1469, 707, 711, -60, -60, -1073, -1080, -1647,
+    -1658, -1854, -1865, -1645, -1655, -939, -945, -29, -29, 935, 941, 1598, 1608, 1992, 2003, 1750,
+    1760, 1085, 1091, 304, 306, -915, -920, -1536, -1544, -1939, -1949, -2065, -2076, -1438, -1446, -442,
+    -444, 655, 659, 1645, 1654, 2093, 2104, 2202, 2213, 1709, 1717, 706, 709, -516, -519, -1539,
+    -1547, -2310, -2321, -2415, -2427, -1924, -1933, -1000, -1005, 308, 309, 1466, 1473, 2304, 2314, 2611,
+    2623, 2169, 2178, 1257, 1263, -1, -1, -1592, -1599, -2148, -2158, -3148, -3161, -2565, -2576, -1520,
+    -1526, -586, -588, 1499, 1505, 2277, 2286, 2921, 2933, 3164, 3164, 1652, 1652, 785, 785, -936,
+    -936, -2504, -2504, -2658, -2658, -3226, -3226, -2146, -2146, -684, -684, 354, 354, 2721, 2721, 2697,
+    2697, 3198, 3198, 2979, 2979, 672, 672, 107, 107, -2005, -2005, -3260, -3260, -2689, -2689, -3292,
+    -3292, -1304, -1304, 234, 234, 1121, 1121, 3386, 3386, 2905, 2905, 2856, 2856, 2238, 2238, -330,
+    -330, -910, -910, -2713, -2713, -3631, -3631, -2567, -2567, -2993, -2993, -167, -167, 1122, 1122, 1983,
+    1983, 4135, 4135, 2720, 2720, 2589, 2589, 1392, 1392, -1512, -1512, -1604, -1604, -3559, -3559, -3662,
+    -3662, -1998, -1998, -2040, -2040, 878, 878, 2146, 2146, 2557, 2557, 4215, 4215, 2251, 2251, 2076,
+    2076, 223, 223, -2597, -2597, -2251, -2251, -4161, -4161, -3330, -3330, -1353, -1353, -1188, -1188, 2188,
+    2188, 2825, 2825, 3090, 3090, 4260, 4260, 1501, 1501, 936, 936, -852, -852, -3526, -3526, -2678,
+    -2678, -3980, -3980, -2700, -2700, -572, -572, -57, -57, 3385, 3385, 3272, 3272, 3442, 3442, 3795,
+    3795, 514, 514, 44, 44, -2150, -2150, -4190, -4190, -2875, -2875, -3877, -3877, -1661, -1661, 671,
+    671, 1052, 1052, 4126, 4126, 3523, 3523, 3008, 3008, 2910, 2910, -646, -646, -1009, -1009, -3347,
+    -3347, -4459, -4459, -2888, -2888, -3291, -3291, -398, -398, 1627, 1627, 2220, 2220, 4738, 4738, 3378,
+    3378, 2680, 2680, 1734, 1734, -1805, -1805, -1924, -1924, -3914, -3914, -4262, -4262, -2151, -2151, -2305,
+    -2305, 980, 980, 2431, 2431, 3175, 3175, 4817, 4817, 2541, 2541, 2297, 2297, 157, 157, -2674,
+    -2674, -2447, -2447, -4560, -4560, -3395, -3395, -1657, -1657, -1254, -1254, 2393, 2393, 2673, 2673, 3514,
+    3514, 4344, 4344, 1511, 1511, 1369, 1368, -1193, -1192, -3303, -3301, -2688, -2686, -4665, -4662, -2243,
+    -2241, -1164, -1163, 117, 117, 3364, 3362, 2747, 2745, 3994, 3991, 3346, 3344, 674, 673, 567,
+    567, -2612, -2610, -3341, -3339, -2987, -2985, -4013, -4010, -1042, -1041, -273, -273, 1296, 1295, 3802,
+    3799, 2659, 2657, 3653, 3650, 2008, 2007, 28, 28, -473, -472, -3638, -3635, -3075, -3073, -3214,
+    -3212, -3091, -3089, 72, 71, 282, 281, 2572, 2570, 3854, 3852, 2640, 2638, 3538, 3535, 643,
+    643, -565, -565, -1592, -1591, -4111, -4108, -2687, -2685, -3237, -3234, -1777, -1776, 633, 633, 1019,
+    1018, 3962, 3959, 3235, 3233, 3057, 3054, 2677, 2675, -587, -586, -814, -813, -3103, -3100, -3957,
+    -3954, -2582, -2580, -3147, -3144, -154, -154, 1138, 1137, 2068, 2066, 4316, 4313, 2698, 2696, 2908,
+    2905, 1289, 1288, -1424, -1423, -1646, -1645, -4172, -4169, -3087, -3084, -2901, -2899, -2036, -2035, 1053,
+    1052, 1128, 1128, 3519, 3517, 3615, 3612, 2435, 2433, 2678, 2676, -563, -563, -1171, -1170, -2566,
+    -2564, -4048, -4044, -2264, -2262, -2773, -2771, -342, -342, 1409, 1408, 1723, 1721, 4161, 4158, 2561,
+    2559, 2831, 2829, 1182, 1181, -1306, -1305, -1330, -1329, -3821, -3818, -3010, -3008, -2371, -2370, -2039,
+    -2038, 1100, 1099, 1165, 1164, 3032, 3029, 3561, 3559, 2031, 2030, 2430, 2429, -425, -425, -1353,
+    -1352, -2147, -2146, -3827, -3823, -2176, -2175, -2666, -2664, -329, -329, 1354, 1353, 1656, 1654, 3872,
+    3869, 2445, 2443, 2332, 2330, 1272, 1271, -1387, -1386, -1263, -1262, -3350, -3348, -2980, -2977, -1929,
+    -1928, -1908, -1907, 983, 982, 1295, 1294, 2556, 2554, 3440, 3437, 1852, 1851, 2446, 2444, -506,
+    -506, -1125, -1124, -2316, -2314, -3742, -3739, -2082, -2080, -2592, -2590, -285, -285, 955, 954, 1695,
+    1693, 3567, 3564, 2102, 2100, 2598, 2596, 838, 838, -884, -884, -1157, -1156, -3336, -3333, -2286,
+    -2284, -2434, -2432, -1473, -1471, 584, 584, 750, 749, 3203, 3200, 2409, 2407, 2581, 2578, 1986,
+    1984, -384, -384, -399, -398, -2683, -2681, -2609, -2607, -2315, -2313, -2409, -2407, 34, 34, 210,
+    210, 2059, 2057, 2741, 2739, 2114, 2112, 2611, 2608, 433, 432, -119, -119, -1681, -1680, -2767,
+    -2765, -2098, -2096, -2945, -2942, -818, -817, -195, -195, 1022, 1021, 2698, 2695, 1984, 1982, 2859,
+    2857, 1334, 1333, 245, 245, -478, -477, -2446, -2444, -1980, -1978, -2640, -2638, -1792, -1790, -368,
+    -368, 89, 89, 2037, 2035, 1909, 1907, 2703, 2700, 2173, 2171, 611, 611, 360, 360, -1749,
+    -1747, -1737, -1736, -2683, -2681, -2333, -2331, -985, -984, -747, -746, 1470, 1468, 1579, 1578, 2449,
+    2447, 2452, 2449, 1217, 1216, 1011, 1010, -994, -993, -1392, -1390, -2201, -2199, -2544, -2542, -1502,
+    -1500, -1466, -1465, 721, 720, 1017, 1016, 2159, 2157, 2544, 2541, 1633, 1632, 1664, 1663, -263,
+    -263, -788, -787, -1823, -1821, -2463, -2460, -1742, -1740, -1794, -1793, -171, -171, 542, 542, 1491,
+    1490, 2303, 2301, 1820, 1818, 2179, 2176, 429, 429, -121, -121, -1273, -1272, -2253, -2250, -1827,
+    -1825, -2212, -2210, -803, -802, -115, -115, 907, 906, 2002, 2000, 1811, 1809, 2178, 2176, 1120,
+    1119, 373, 372, -610, -609, -1560, -1558, -1818, -1816, -1934, -1932, -1376, -1375, -757, -756, 316,
+    316, 1332, 1330, 1672, 1671, 2132, 2130, 1521, 1519, 1016, 1014, -9, -9, -942, -941, -1540,
+    -1538, -1950, -1948, -1684, -1682, -1181, -1180, -298, -298, 587, 586, 1363, 1361, 1730, 1728, 1792,
+    1790, 1279, 1278, 592, 591, -261, -261, -1099, -1098, -1750, -1748, -1774, -1772, -1595, -1593, -859,
+    -858, -32, -32, 838, 837, 1464, 1462, 1784, 1782, 1568, 1566, 1127, 1125, 276, 276, -559,
+    -558, -1171, -1170, -1750, -1748, -1486, -1484, -1360, -1358, -472, -472, 161, 161, 954, 953, 1556,
+    1554, 1392, 1391, 1614, 1612, 515, 515, 278, 277, -758, -757, -1286, -1285, -1210, -1209, -1727,
+    -1725, -494, -494, -681, -680, 656, 655, 896, 895, 1210, 1208, 1657, 1655, 620, 620, 997,
+    995, -568, -567, -465, -464, -1428, -1427, -1410, -1408, -1065, -1063, -1091, -1090, 289, 288, 120,
+    120, 1399, 1397, 1143, 1141, 1249, 1248, 1135, 1134, -42, -42, 182, 181, -1317, -1315, -840,
+    -839, -1428, -1426, -1061, -1059, -268, -267, -375, -374, 1149, 1147, 548, 547, 1681, 1679, 885,
+    883, 856, 855, 283, 282, -713, -712, -445, -445, -1676, -1674, -628, -628, -1227, -1225, -178,
+    -178, 221, 220, 389, 388, 1436, 1434, 492, 491, 1430, 1428, 56, 56, 282, 281, -679,
+    -678, -921, -920, -747, -746, -1370, -1368, -297, -297, -790, -789, 780, 779, 317, 317, 1265,
+    1263, 1008, 1006, 669, 668, 801, 800, -553, -552, 9, 9, -1380, -1378, -617, -616, -1092,
+    -1090, -597, -596, 102, 102, -71, -71, 1227, 1225, 331, 330, 1298, 1296, 171, 171, 738,
+    737, -387, -386, -412, -411, -655, -654, -1096, -1094, -310, -309, -878, -877, 393, 393, -65,
+    -65, 843, 842, 612, 611, 629, 628, 660, 659, -95, -95, 174, 173, -738, -737, -330,
+    -329, -792, -791, -409, -408, -431, -430, -21, -21, 461, 461, 308, 308, 952, 951, 272,
+    272, 709, 708, -120, -120, -15, -15, -488, -487, -617, -616, -455, -454, -652, -651, -1,
+    -1, -86, -86, 358, 358, 338, 337, 500, 499, 381, 381, 265, 264, 61, 61, -176,
+    -176, -303, -302, -489, -488, -397, -396, -346, -345, -153, -152, 59, 59, 201, 201, 337,
+    337, 379, 379, 245, 245, 289, 288, -115, -115, 61, 60, -415, -414, -15, -15, -416,
+    -415, -187, -187, -144, -144, 49, 49, 237, 236, 343, 343, 396, 395, 298, 297, 240,
+    240, -27, -27, -22, -22, -359, -358, -196, -195, -358, -358, -164, -164, -63, -63, -39,
+    -39, 295, 295, 2, 2, 472, 472, -111, -110, 392, 391, -264, -263, 99, 99, -351,
+    -350, -96, -96, -252, -251, -165, -164, 58, 57, -162, -162, 365, 365, -182, -181, 483,
+    482, -239, -239, 372, 371, -263, -262, 153, 153, -261, -260, -74, -74, -99, -99, -206,
+    -206, 167, 167, -225, -224, 266, 265, -166, -165, 418, 417, -286, -285, 419, 419, -371,
+    -370, 325, 324, -336, -336, 196, 196, -176, -175, 47, 47, 33, 33, -129, -129, 203,
+    202, -302, -302, 300, 300, -400, -400, 345, 344, -363, -362, 351, 350, -337, -336, 328,
+    327, -204, -203, 193, 193, -60, -60, -20, -20, 28, 28, -184, -183, 140, 140, -311,
+    -311, 242, 242, -317, -316, 353, 352, -236, -236, 407, 406, -156, -156, 330, 329, -147,
+    -146, 127, 126, -184, -184, 53, 53, -200, -199, -76, -75, -54, -53, -89, -89, 157,
+    157, -33, -33, 318, 318, -17, -17, 316, 315, -108, -108, 148, 148, -250, -250, -54,
+    -54, -306, -305, -125, -125, -185, -185, -11, -11, 6, 6, 184, 184, 84, 84, 227,
+    227, 125, 125, 91, 91, 11, 11, -123, -122, -141, -141, -254, -254, -175, -175, -189,
+    -188, -37, -37, 38, 38, 161, 161, 248, 247, 233, 233, 263, 262, 91, 90, 68,
+    67, -175, -175, -171, -171, -254, -253, -229, -229, -210, -209, -68, -68, 23, 23, 166,
+    166, 258, 258, 296, 295, 299, 298, 143, 143, 102, 102, -185, -185, -141, -141, -441,
+    -440, -192, -191, -430, -428, 36, 36, -178, -177, 389, 388, 80, 80, 488, 487, 120,
+    120, 415, 414, -128, -127, 138, 138, -444, -443, -98, -98, -569, -568, -80, -79, -392,
+    -391, 184, 184, -42, -42, 463, 461, 192, 191, 546, 544, 136, 136, 271, 270, -173,
+    -172, -102, -102, -466, -464, -210, -209, -484, -483, -96, -96, -190, -189, 215, 214, 170,
+    169, 444, 442, 313, 312, 371, 370, 139, 138, 30, 30, -193, -192, -317, -316, -385,
+    -383, -397, -395, -255, -254, -154, -154, 110, 109, 195, 194, 407, 405, 387, 386, 358,
+    356, 221, 220, 73, 72, -144, -144, -273, -272, -388, -386, -381, -379, -332, -331, -167,
+    -166, -8, -8, 194, 193, 316, 315, 403, 401, 371, 369, 286, 284, 113, 112, -65,
+    -65, -241, -240, -361, -360, -372, -370, -336, -335, -219, -218, -58, -58, 120, 120, 266,
+    265, 368, 366, 374, 372, 315, 313, 173, 172, 1, 1, -175, -174, -322, -320, -361,
+    -359, -373, -371, -252, -251, -141, -140, 76, 75, 184, 183, 358, 356, 310, 308, 355,
+    353, 168, 166, 116, 115, -146, -146, -172, -171, -381, -378, -267, -265, -406, -403, -69,
+    -69, -137, -136, 251, 249, 149, 148, 453, 450, 218, 216, 377, 374, 18, 18, 86,
+    85, -276, -273, -177, -175, -388, -384, -218, -216, -275, -273, -26, -25, 2, 2, 223,
+    221, 226, 224, 317, 314, 230, 228, 178, 177, 33, 32, -100, -99, -175, -173, -288,
+    -285, -242, -239, -255, -253, -96, -95, -43, -43, 139, 138, 169, 167, 283, 279, 186,
+    183, 217, 214, 48, 48, 20, 19, -142, -140, -154, -152, -229, -225, -174, -171, -149,
+    -146, -44, -43, 27, 26, 114, 112, 157, 154, 173, 169, 152, 149, 97, 96, 25,
+    25, -40, -39, -108, -106, -126, -123, -136, -132, -101, -98, -71, -69, 0, 0, 29,
+    28, 88, 85, 85, 82, 89, 85,
+};
+
+const int16_t embeddedBoomPcm[12541] = {
+    0, 0, 0, 0, 0, 0, -6109, -6108, -6107, -6106, -6105, -6103, -6102, -6101, -6100, -6099,
+    -6097, -6096, -6095, -6094, -6093, -6091, -6090, -6089, -6088, -6087, -6085, -6084, -6083, -6082, -6081, -6079,
+    -6078, -6077, -6076, -6075, -6073, -6072, -6071, -6070, -6069, -6067, -6066, -6065, -6064, -6063, -6061, -6060,
+    -6059, -6058, -6057, -6056, -6054, -6053, -6052, -6051, -6050, -6048, -6047, -6046, -6045, -6044, -6042, -6041,
+    -6040, -6039, -6038, -6036, -6035, -9507, -9505, -9503, -9501, -9499, -9498, -9496, -9494, -9492, -9490, -9488,
+    -9486, -9484, -9482, -9481, -9479, -9477, -9475, -9473, -9471, -9469, -9467, -9465, -9464, -9462, -9460, -9458,
+    -9456, -9454, -9452, -9450, -9448, -9447, -9445, -9443, -9441, -9439, -9437, -9435, -9433, -9431, -9430, -9428,
+    -9426, -9424, -9422, -9420, -9418, -9416, -9414, -9413, -9411, -9409, -9407, -9405, -9403, -9401, -9399, -9397,
+    -9396, -9394, -9392, -9390, -9388, -9386, -9384, -856, -856, -855, -855, -855, -855, -855, -854, -854,
+    -854, -854, -854, -854, -853, -853, -853, -853, -853, -853, -852, -852, -852, -852, -852, -852,
+    -851, -851, -851, -851, -851, -851, -850, -850, -850, -850, -850, -849, -849, -849, -849, -849,
+    -849, -848, -848, -848, -848, -848, -848, -847, -847, -847, -847, -847, -847, -846, -846, -846,
+    -846, -846, -846, 6856, 6855, 6853, 6852, 6851, 6849, 6848, 6846, 6845, 6844, 6842, 6841, 6839,
+    6838, 6837, 6835, 6834, 6832, 6831, 6830, 6828, 6827, 6826, 6824, 6823, 6821, 6820, 6819, 6817,
+    6816, 6814, 6813, 6812, 6810, 6809, 6807, 6806, 6805, 6803, 6802, 6800, 6799, 6798, 6796, 6795,
+    6793, 6792, 6791, 6789, 6788, 6786, 6785, 6784, 6782, 6781, 6779, 6778, 6777, 6775, 6774, -1587,
+    -1587, -1587, -1586, -1586, -1586, -9935, -9932, -9930, -9928, -9926, -9924, -9922, -9920, -9918, -9916, -9914,
+    -9912, -9910, -9908, -9906, -9904, -9902, -9900, -9898, -9896, -9893, -9891, -9889, -9887, -9885, -9883, -9881,
+    -9879, -9877, -9875, -9873, -9871, -9869, -9867, -9865, -9863, -9861, -9859, -9856, -9854, -9852, -9850, -9848,
+    -9846, -9844, -9842, -9840, -9838, -9836, -9834, -9832, -9830, -9828, -9826, -9824, -9822, -9820, -9817, -9815,
+    -9813, 7275, 7274, 7272, 7271, 7269, 7268, 7266, 7265, 7263, 7262, 7260, 7259, 7257, 7255, 7254,
+    7252, 7251, 7249, 7248, 7246, 7245, 7243, 7242, 7240, 7239, 7237, 7236, 7234, 7233, 7231, 7230,
+    7228, 7227, 7225, 7224, 7222, 7220, 7219, 7217, 7216, 7214, 7213, 7211, 7210, 7208, 7207, 7205,
+    7204, 7202, 7201, 7199, 7198, 7196, 7195, 7193, 7192, 7190, 7188, 7187, 7185, -11328, -11325, -11323,
+    -11321, -11318, -11316, -11313, -11311, -11309, -11306, -11304, -11301, -11299, -11297, -11294, -11292, -11289, -11287, -11285,
+    -11282, -11280, -11277, -11275, -11273, -11270, -11268, -11265, -11263, -11261, -11258, -11256, -11253, -11251, -11249, -11246,
+    -11244, -11241, -11239, -11237, -11234, -11232, -11229, -11227, -11225, -11222, -11220, -11217, -11215, -11213, -11210, -11208,
+    -11205, -11203, -11201, -11198, -11196, -11193, 10720, 10718, 10715, 10713, 10711, 10709, 10706, 10704, 10702, 10699,
+    10697, 10695, 10692, 10690, 10688, 10686, 10683, 10681, 10679, 10676, 10674, 10672, 10669, 10667, 10665, 10663,
+    10660, 10658, 10656, 10653, 10651, 10649, 10646, 10644, 10642, 10640, 10637, 10635, 10633, 10630, 10628, 10626,
+    10623, 10621, 10619, 10617, 10614, 10612, 10610, 10607, 10605, 10603, 10600, 10598, 10596, 10594, 10591, 10589,
+    10587, 10584, 5033, 5032, 5031, 5030, 5029, 5027, 5026, 5025, 5024, 5023, 5022, 5021, 5020, 5019,
+    5018, 5017, 5015, 5014, 5013, 5012, 5011, 5010, 5009, 5008, 5007, 5006, 5005, 5003, 5002, 5001,
+    5000, 4999, 4998, 4997, 4996, 4995, 4994, 4992, 4991, 4990, 4989, 4988, 4987, 4986, 4985, 4984,
+    4983, 4982, 4980, 4979, 4978, 4977, 4976, 4975, 4974, 5463, 5462, 5461, 5459, 5458, 5457, 5456,
+    5455, 5453, 5452, 5451, 5450, 5449, 5447, 5446, 5445, 5444, 5443, 5441, 5440, 5439, 5438, 5437,
+    5435, 5434, 5433, 5432, 5430, 5429, 5428, 5427, 5426, 5424, 5423, 5422, 5421, 5420, 5418, 5417,
+    5416, 5415, 5414, 5412, 5411, 5410, 5409, 5408, 5406, 5405, 5404, 5403, 5402, 5400, 5399, 5398,
+    -3227, -3226, -3225, -3225, -3224, -11837, -11835, -11832, -11829, -11827, -11824, -11821, -11819, -11816, -11813, -11811,
+    -11808, -11806, -11803, -11800, -11798, -11795, -11792, -11790, -11787, -11784, -11782, -11779, -11777, -11774, -11771, -11769,
+    -11766, -11763, -11761, -11758, -11755, -11753, -11750, -11747, -11745, -11742, -11740, -11737, -11734, -11732, -11729, -11726,
+    -11724, -11721, -11718, -11716, -11713, -11711, -11708, -11705, -11703, -11700, -11697, -11695, -11128, -11125, -11123, -11120,
+    -11118, -11115, -11113, -11110, -11108, -11105, -11103, -11100, -11098, -11095, -11093, -11090, -11088, -11085, -11083, -11080,
+    -11078, -11075, -11073, -11070, -11068, -11065, -11063, -11060, -11058, -11055, -11053, -11050, -11048, -11045, -11042, -11040,
+    -11037, -11035, -11032, -11030, -11027, -11025, -11022, -11020, -11017, -11015, -11012, -11010, -11007, -11005, -11002, -11000,
+    -10997, -10995, -10992, -6242, -6241, -6240, -6238, -6237, -6235, -6234, -6232, -6231, -6230, -6228, -6227, -6225,
+    -6224, -6222, -6221, -6220, -6218, -6217, -6215, -6214, -6212, -6211, -6210, -6208, -6207, -6205, -6204, -6202,
+    -6201, -6200, -6198, -6197, -6195, -6194, -6193, -6191, -6190, -6188, -6187, -6185, -6184, -6183, -6181, -6180,
+    -6178, -6177, -6175, -6174, -6173, -4415, -4414, -4413, -4412, -4411, -3825, -3824, -3824, -3823, -3822, -3821,
+    -3820, -3819, -3818, -3817, -3816, -3816, -3815, -3814, -3813, -3812, -3811, -3810, -3809, -3808, -3808, -3807,
+    -3806, -3805, -3804, -3803, -3802, -3801, -3800, -3800, -3799, -3798, -3797, -3796, -3795, -3794, -3793, -3793,
+    -3792, -3791, -3790, -3789, -3788, -3787, -3786, -3785, -3785, -3784, -3783, -3782, 11458, 11455, 11453, 11450,
+    11447, 11445, 11442, 11439, 11437, 11434, 11431, 11428, 11426, 11423, 11420, 11418, 11415, 11412, 11410, 11407,
+    11404, 11402, 11399, 11396, 11394, 11391, 11388, 11386, 11383, 11380, 11378, 11375, 11372, 11369, 11367, 11364,
+    11361, 11359, 11356, 11353, 11351, 11348, 11345, 11343, 11340, 11337, 11335, 11332, 11329, 11327, 11324, 11321,
+    5369, 5368, 5367, 5366, 5364, 5363, 5362, 5360, 5359, 5358, 5357, 5355, 5354, 5353, 5352, 5350,
+    5349, 5348, 5346, 5345, 5344, 5343, 5341, 5340, 5339, 5338, 5336, 5335, 5334, 5332, 5331, 5330,
+    5329, 5327, 5326, 5325, 5324, 5322, 5321, 5320, 5318, 5317, 5316, 5315, 5313, 5312, 5311, 5310,
+    5308, 5307, 5306, 5304, 79, 79, 79, 79, 79, 79, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 10628, 10625, 10623, 10620, 10618, 10615, 10612, 10610,
+    10607, 10605, 10602, 10599, 10597, 10594, 10592, 10589, 10587, 10584, 10581, 10579, 10576, 10574, 10571, 10568,
+    10566, 10563, 10561, 10558, 10556, 10553, 10550, 10548, 10545, 10543, 10540, 10537, 10535, 10532, 10530, 10527,
+    10525, 10522, 10519, 10517, 10514, 10512, 10509, 10506, 10504, 10501, 10499, 10496, -6988, -6986, -6984, -6983,
+    -6981, -6979, -6977, -6976, -6974, -6972, -6971, -6969, -6967, -6965, -6964, -6962, -6960, -6959, -6957, -6955,
+    -6953, -6952, -6950, -6948, -6946, -6945, -6943, -6941, -6940, -6938, -6936, -6934, -6933, -6931, -6929, -6928,
+    -6926, -6924, -6922, -6921, -6919, -6917, -6916, -6914, -6912, -6910, -6909, -6907, -9953, -9950, -9948, -9945,
+    -9943, -9940, -9938, -9936, -9933, -9931, -9928, -9926, -9923, -9921, -9918, -9916, -9913, -9911, -9908, -9906,
+    -9903, -9901, -9898, -9896, -9893, -9891, -9888, -9886, -9883, -9881, -9879, -9876, -9874, -9871, -9869, -9866,
+    -9864, -9861, -9859, -9856, -9854, -9851, -9849, -9846, -9844, -9841, -9839, -9836, 8454, 8452, 8450, 8447,
+    8445, 8443, 8441, 8439, 8437, 8435, 8433, 8430, 8428, 8426, 8424, 8422, 8420, 8418, 8415, 8413,
+    8411, 8409, 8407, 8405, 8403, 8401, 8398, 8396, 8394, 8392, 8390, 8388, 8386, 8383, 8381, 8379,
+    8377, 8375, 8373, 8371, 8369, 8366, 8364, 8362, 8360, 8358, 8356, 8354, 4258, 4257, 4256, 4254,
+    -8015, -8013, -8011, -8009, -8007, -8005, -8003, -8001, -7999, -7997, -7995, -7993, -7991, -7989, -7987, -7985,
+    -7983, -7981, -7979, -7977, -7974, -7972, -7970, -7968, -7966, -7964, -7962, -7960, -7958, -7956, -7954, -7952,
+    -7950, -7948, -7946, -7944, -7942, -7940, -7938, -7936, -7934, -7931, -7929, -7927, -7925, -7923, -5525, -5524,
+    -5522, -5521, -5519, -5518, -5516, -5515, -5514, -5512, -5511, -5509, -5508, -5506, -5505, -5504, -5502, -5501,
+    -5499, -5498, -5496, -5495, -5494, -5492, -5491, -5489, -5488, -5486, -5485, -5484, -5482, -5481, -5479, -5478,
+    -5476, -5475, -5474, -5472, -5471, -5469, -5468, -5466, -5465, -5464, -5462, -5461, -5459, -5458, 4548, 4546,
+    4545, 4544, 4543, 4542, 4540, 4539, 4538, 4537, 4536, 4534, 4533, 4532, 4531, 4530, 4529, 4527,
+    4526, 4525, 4524, 4523, 4521, 4520, 4519, 4518, 4517, 4515, 4514, 4513, 4512, 4511, 4509, 4508,
+    4507, 4506, 4505, 4504, 4502, 4501, 4500, 4499, 4498, 4496, 4495, 5334, 5333, 5332, 5450, 5449,
+    5447, 5446, 5444, 5443, 5441, 5440, 5438, 5437, 5436, 5434, 5433, 5431, 5430, 5428, 5427, 5425,
+    5424, 5423, 5421, 5420, 5418, 5417, 5415, 5414, 5412, 5411, 5410, 5408, 5407, 5405, 5404, 5402,
+    5401, 5399, 5398, 5397, 5395, 5394, 5392, 5391, 5389, 5388, 5386, -3944, -3943, -3942, -3941, -3940,
+    -3938, -3937, -3936, -3935, -3934, -3933, -3932, -3931, -3930, -3929, -3928, -3927, -3926, -3925, -3924, -3923,
+    -3922, -3920, -3919, -3918, -3917, -3916, -3915, -3914, -3913, -3912, -3911, -3910, -3909, -3908, -3907, -3906,
+    -3905, -3904, -3903, -3901, -3900, -3899, -3898, -3897, -5718, -5716, -5714, -5713, -5711, -5710, -5708, -5707,
+    -5705, -5704, -5702, -5700, -5699, -5697, -5696, -5694, -5693, -5691, -5690, -5688, -5687, -5685, -5683, -5682,
+    -5680, -5679, -5677, -5676, -5674, -5673, -5671, -5669, -5668, -5666, -5665, -5663, -5662, -5660, -5659, -5657,
+    -5655, -5654, -5652, -5651, -5649, 6750, 6748, 6746, 6744, 6742, 6740, 6739, 6737, 6735, 6733, 6731,
+    6729, 6727, 6726, 6724, 6722, 6720, 6718, 6716, 6714, 6713, 6711, 6709, 6707, 6705, 6703, 6701,
+    6700, 6698, 6696, 6694, 6692, 6690, 6688, 6687, 6685, 6683, 6681, 6679, 6677, 6675, 6674, 6672,
+    6670, 6668, 7936, 7934, 7931, 7929, 7927, 7925, 7923, 7920, 7918, 7916, 7914, 7911, 7909, 7907,
+    7905, 7903, 7900, 7898, 7896, 7894, 7892, 7889, 7887, 7885, 7883, 7881, 7878, 7876, 7874, 7872,
+    7869, 7867, 7865, 7863, 7861, 7858, 7856, 7854, 7852, 7850, 7847, 7845, 7843, 7841, 7839, 1823,
+    1822, 1822, 1821, 1821, 1820, 1820, 1819, 1819, 1818, 1817, 1817, 1816, 1816, 1815, 1815, 1814,
+    1814, 1813, 1813, 1812, 1812, 1811, 1811, 1810, 1810, 1809, 1809, 1808, 1808, 1807, 1807, 1806,
+    1806, 1805, 1805, 1804, 1804, 1803, 1803, 1802, 1802, -6599, -6597, -6595, -9391, -9388, -9385, -9383,
+    -9380, -9377, -9375, -9372, -9369, -9367, -9364, -9361, -9359, -9356, -9353, -9350, -9348, -9345, -9342, -9340,
+    -9337, -9334, -9332, -9329, -9326, -9324, -9321, -9318, -9316, -9313, -9310, -9308, -9305, -9302, -9300, -9297,
+    -9294, -9291, -9289, -9286, -9283, -9281, -2718, -2717, -2716, -2715, -2715, -2714, -2713, -2712, -2712, -2711,
+    -2710, -2709, -2708, -2708, -2707, -2706, -2705, -2704, -2704, -2703, -2702, -2701, -2701, -2700, -2699, -2698,
+    -2697, -2697, -2696, -2695, -2694, -2694, -2693, -2692, -2691, -2690, -2690, -2689, -2688, -2687, -2686, -2686,
+    -1448, -1448, -1447, -1447, -1447, -1446, -1446, -1445, -1445, -1444, -1444, -1444, -1443, -1443, -1442, -1442,
+    -1441, -1441, -1441, -1440, -1440, -1439, -1439, -1438, -1438, -1438, -1437, -1437, -1436, -1436, -1436, -1435,
+    -1435, -1434, -1434, -1433, -1433, -1433, -1432, -1432, -1431, -1431, -1430, -1430, -1430, -1429, -1429, -1428,
+    -1428, -1427, -1427, -679, -679, -678, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+    69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+    68, 68, 68, 68, 68, 68, 165, 165, 845, 845, 845, 844, 844, 844, 844, 843,
+    843, 843, 843, 842, 842, 842, 842, 841, 841, 841, 841, 840, 840, 840, 840, 839,
+    839, 839, 838, 838, 838, 838, 837, 837, 837, 837, 836, 836, 836, 836, 835, 835,
+    835, 835, 834, 834, 834, 834, 833, 833, 833, 833, -2431, -2430, -2430, -2429, -2428, -2427,
+    -2427, -2426, -2425, -2424, -2424, -2423, -2422, -2421, -2421, -2420, -2419, -2418, -2418, -2417, -2416, -2415,
+    -2415, -2414, -2413, -2412, -2412, -2411, -2410, -2409, -2409, -2408, -2407, -2406, -2406, -2405, -2404, -2404,
+    -2403, -2402, -2401, -2401, -2400, -2399, -2398, -2398, -2397, -2396, -2395, -2395, 7112, 7110, 7107, 7105,
+    7103, 7101, 7099, 7096, 7094, 7092, 7090, 7087, 7085, 7083, 7081, 7079, 7076, 7074, 7072, 7070,
+    7068, 7065, 7063, 7061, 7059, 7056, 7054, 7052, 7050, 7048, 7045, 7043, 7041, 7039, 7037, 7034,
+    7032, 7030, 7028, 7025, 7023, 7021, 7019, 7017, 7014, 7012, 7010, 7008, 6824, 6822, 5551, 5549,
+    5547, 5545, 5544, 5542, 5540, 5538, 5537, 5535, 5533, 5531, 5530, 5528, 5526, 5524, 5523, 5521,
+    5519, 5517, 5516, 5514, 5512, 5510, 5509, 5507, 5505, 5503, 5502, 5500, 5498, 5496, 5495, 5493,
+    5491, 5489, 5488, 5486, 5484, 5482, 5481, 5479, 5477, 5475, 5473, 5472, 5470, 5468, 4635, 4634,
+    4633, 4631, 4630, 4628, 4627, 4625, 4624, 4622, 4621, 4619, 4618, 4616, 4615, 4613, 4612, 4610,
+    4609, 4607, 4606, 4604, 4603, 4601, 4600, 4598, 4597, 4595, 4594, 4592, 4591, 4589, 4588, 4586,
+    4585, 4583, 4582, 4580, 4579, 4577, 4576, 4574, 4573, 4572, 4570, 4569, 4567, 4566, 5735, 5733,
+    5731, 5729, 5728, 5726, 5724, 5722, 5720, 5718, 5716, 5715, 5713, 5711, 5709, 5707, 5705, 5703,
+    5701, 5700, 5698, 5696, 5694, 5692, 5690, 5688, 5686, 5685, 5683, 5681, 5679, 5677, 5675, 5673,
+    5672, 5670, 5668, 5666, 5664, 5662, 5660, 5658, 5657, 5655, 5653, 5651, 3955, 3954, -7899, -7897,
+    -7894, -7891, -7889, -7886, -7884, -7881, -7878, -7876, -7873, -7871, -7868, -7865, -7863, -7860, -7857, -7855,
+    -7852, -7850, -7847, -7844, -7844, -7843, -7842, -7842, -7841, -7840, -7839, -7839, -7838, -7837, -7836, -7836,
+    -7835, -7834, -7833, -7833, -7832, -7831, -7830, -7830, -7829, -7828, -7828, -7827, -4906, -4906, -4905, -4905,
+    -4904, -4904, -4903, -4903, -4902, -4902, -4901, -4901, -4901, -4900, -4900, -4899, -4899, -4898, -4898, -4897,
+    -4897, -4896, -4896, -4895, -4895, -4894, -4894, -4894, -4893, -4893, -4892, -4892, -4891, -4891, -4890, -4890,
+    -4889, -4889, -4888, -4888, -4887, -4887, -4887, -4886, -4886, -4885, 770, 770, 770, 770, 770, 769,
+    769, 769, 769, 769, 769, 769, 769, 769, 769, 769, 769, 769, 769, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 767, 767, 767, 767, 767, 767,
+    767, 767, 767, 767, 767, 767, 767, 767, 6694, 6694, 6693, 6692, 6692, 6691, 6690, 6690,
+    6689, 6688, 6688, 6687, 6687, 6686, 6685, 6685, 6684, 6683, 6683, 6682, 6681, 6681, 6680, 6679,
+    6679, 6678, 6678, 6677, 6676, 6676, 6675, 6674, 6674, 6673, 6672, 6672, 6671, 6671, 6670, 6669,
+    6669, 6668, 6667, 6667, 5454, 5453, 3433, 3433, 3432, 3432, 3432, 3431, 3431, 3431, 3430, 3430,
+    3430, 3429, 3429, 3429, 3428, 3428, 3428, 3427, 3427, 3427, 3426, 3426, 3426, 3425, 3425, 3425,
+    3424, 3424, 3424, 3424, 3423, 3423, 3423, 3422, 3422, 3422, 3421, 3421, 3421, 3420, 3420, 3420,
+    3419, 3419, 5783, 5783, 5782, 5782, 5781, 5780, 5780, 5779, 5779, 5778, 5778, 5777, 5777, 5776,
+    5775, 5775, 5774, 5774, 5773, 5773, 5772, 5772, 5771, 5770, 5770, 5769, 5769, 5768, 5768, 5767,
+    5767, 5766, 5765, 5765, 5764, 5764, 5763, 5763, 5762, 5761, 5761, 5760, 5760, 5759, 7488, 7487,
+    7486, 7486, 7485, 7484, 7483, 7483, 7482, 7481, 7481, 7480, 7479, 7478, 7478, 7477, 7476, 7475,
+    7475, 7474, 7473, 7473, 7472, 7471, 7470, 7470, 7469, 7468, 7467, 7467, 7466, 7465, 7465, 7464,
+    7463, 7462, 7462, 7461, 7460, 7459, 7459, 7458, 7489, 7488, 7710, 7709, 7708, 7708, 7707, 7706,
+    7705, 7705, 7704, 7703, 7702, 7702, 7701, 7700, 7699, 7699, 7698, 7697, 7696, 7696, 7695, 7694,
+    7693, 7693, 7692, 7691, 7690, 7690, 7689, 7688, 7687, 7687, 7686, 7685, 7684, 7684, 7683, 7682,
+    7681, 7681, 7680, 7679, 2043, 2042, 2042, 2042, 2042, 2042, 2041, 2041, 2041, 2041, 2041, 2040,
+    2040, 2040, 2040, 2040, 2039, 2039, 2039, 2039, 2039, 2038, 2038, 2038, 2038, 2038, 2037, 2037,
+    2037, 2037, 2037, 2036, 2036, 2036, 2036, 2036, 2035, 2035, 2035, 2035, 2035, 2034, -1438, -1438,
+    -3521, -3521, -3521, -3520, -3520, -3520, -3519, -3519, -3519, -3518, -3518, -3517, -3517, -3517, -3516, -3516,
+    -3516, -3515, -3515, -3515, -3514, -3514, -3514, -3513, -3513, -3513, -3512, -3512, -3512, -3511, -3511, -3511,
+    -3510, -3510, -3510, -3509, -3509, -3508, -3508, -3508, -2123, -2123, -739, -739, -738, -738, -738, -738,
+    -738, -738, -738, -738, -738, -738, -738, -738, -738, -738, -737, -737, -737, -737, -737, -737,
+    -737, -737, -737, -737, -737, -737, -737, -737, -736, -736, -736, -736, -736, -736, -736, -736,
+    -736, -736, -3471, -3470, -3470, -3470, -3469, -3469, -3469, -3468, -3468, -3468, -3467, -3467, -3467, -3466,
+    -3466, -3466, -3465, -3465, -3465, -3464, -3464, -3464, -3463, -3463, -3463, -3462, -3462, -3461, -3461, -3461,
+    -3460, -3460, -3460, -3459, -3459, -3459, -3458, -3458, -3458, -3457, -3457, -3457, -3812, -3811, -3811, -3810,
+    -3810, -3810, -3809, -3809, -3809, -3808, -3808, -3807, -3807, -3807, -3806, -3806, -3806, -3805, -3805, -3804,
+    -3804, -3804, -3803, -3803, -3803, -3802, -3802, -3801, -3801, -3801, -3800, -3800, -3799, -3799, -3799, -3798,
+    -3798, -3798, -3797, -3797, 3466, 3466, 3465, 3465, 3465, 3464, 3464, 3464, 3463, 3463, 3462, 3462,
+    3462, 3461, 3461, 3461, 3460, 3460, 3460, 3459, 3459, 3459, 3458, 3458, 3458, 3457, 3457, 3457,
+    3456, 3456, 3456, 3455, 3455, 3455, 3454, 3454, 3453, 3453, 3453, 3452, 1174, 1174, 415, 415,
+    414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+    414, 414, 414, 414, 414, 414, 414, 414, 413, 413, 413, 413, 413, 413, 413, 413,
+    413, 413, 413, 413, 1801, 1801, 1999, 1998, 1998, 1998, 1998, 1998, 1997, 1997, 1997, 1997,
+    1997, 1996, 1996, 1996, 1996, 1996, 1995, 1995, 1995, 1995, 1995, 1994, 1994, 1994, 1994, 1994,
+    1993, 1993, 1993, 1993, 1993, 1992, 1992, 1992, 1992, 1992, 1991, 1991, 4405, 4404, 4404, 4404,
+    4403, 4403, 4402, 4402, 4401, 4401, 4400, 4400, 4400, 4399, 4399, 4398, 4398, 4397, 4397, 4396,
+    4396, 4396, 4395, 4395, 4394, 4394, 4393, 4393, 4392, 4392, 4392, 4391, 4391, 4390, 4390, 4389,
+    4389, 4388, 3206, 3206, -5063, -5063, -5062, -5062, -5061, -5061, -5060, -5060, -5059, -5059, -5058, -5058,
+    -5057, -5057, -5056, -5056, -5055, -5055, -5054, -5054, -5053, -5053, -5052, -5052, -5051, -5051, -5050, -5050,
+    -5049, -5049, -5048, -5048, -5047, -5046, -5046, -5045, -5045, -5044, -1300, -1300, -1300, -1300, -1300, -1300,
+    -1299, -1299, -1299, -1299, -1299, -1299, -1299, -1299, -1298, -1298, -1298, -1298, -1298, -1298, -1298, -1297,
+    -1297, -1297, -1297, -1297, -1297, -1297, -1297, -1296, -1296, -1296, -1296, -1296, -1296, -1296, -1296, -1295,
+    -3242, -3241, -3241, -3241, -3240, -3240, -3240, -3239, -3239, -3239, -3238, -3238, -3238, -3237, -3237, -3237,
+    -3236, -3236, -3236, -3235, -3235, -3235, -3234, -3234, -3234, -3233, -3233, -3233, -3232, -3232, -3232, -3231,
+    -3231, -3231, -3230, -3230, -3230, -3229, 6837, 6836, 6835, 6834, 6834, 6833, 6832, 6832, 6831, 6830,
+    6830, 6829, 6828, 6827, 6827, 6826, 6825, 6825, 6824, 6823, 6822, 6822, 6821, 6820, 6820, 6819,
+    6818, 6818, 6817, 6816, 6815, 6815, 6814, 6813, 6813, 6812, 6811, 6811, 7404, 7403, 7403, 7402,
+    7401, 7400, 7399, 7399, 7398, 7397, 7396, 7396, 7395, 7394, 7393, 7393, 7392, 7391, 7390, 7390,
+    7389, 7388, 7387, 7387, 7386, 7385, 7384, 7383, 7383, 7382, 7381, 7380, 7380, 7379, 7378, 7377,
+    2136, 2136, -3104, -3103, -3103, -3103, -3102, -3102, -3102, -3101, -3101, -3101, -3100, -3100, -3100, -3099,
+    -3099, -3099, -3099, -3098, -3098, -3098, -3097, -3097, -3097, -3096, -3096, -3096, -3095, -3095, -3095, -3094,
+    -3094, -3094, -3093, -3093, -3093, -3092, 5279, 5279, 5278, 5278, 5277, 5277, 5276, 5275, 5275, 5274,
+    5274, 5273, 5273, 5272, 5272, 5271, 5271, 5270, 5269, 5269, 5268, 5268, 5267, 5267, 5266, 5266,
+    5265, 5264, 5264, 5263, 5263, 5262, 5262, 5261, 5261, 5260, -98, -98, -98, -98, -98, -98,
+    -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98,
+    -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98, -98,
+    -98, -98, -98, -98, -290, -290, -1637, -1637, -1637, -1637, -1636, -1636, -1636, -1636, -1636, -1636,
+    -1635, -1635, -1635, -1635, -1635, -1635, -1634, -1634, -1634, -1634, -1634, -1633, -1633, -1633, -1633, -1633,
+    -1633, -1632, -1632, -1632, -1632, -1632, -1632, -1631, -1631, -1631, -1631, -1631, -1631, -1630, -1630, -1630,
+    5793, 5793, 5792, 5792, 5791, 5790, 5790, 5789, 5789, 5788, 5787, 5787, 5786, 5786, 5785, 5784,
+    5784, 5783, 5782, 5782, 5781, 5781, 5780, 5779, 5779, 5778, 5778, 5777, 5776, 5776, 5775, 5775,
+    5774, 5773, 5773, 5772, 5771, 5771, 5770, 5770, 5769, 5768, -3914, -3913, -3913, -3913, -3912, -3912,
+    -3911, -3911, -3910, -3910, -3910, -3909, -3909, -3908, -3908, -3908, -3907, -3907, -3906, -3906, -3906, -3905,
+    -3905, -3904, -3904, -3903, -3903, -3903, -3902, -3902, -3901, -3901, -3901, -3900, -3900, -3899, -3899, -3898,
+    -3898, -3898, -3897, -3897, 3295, 3295, 3295, 3294, 3294, 3294, 3293, 3293, 3293, 3292, 3292, 3291,
+    3291, 3291, 3290, 3290, 3290, 3289, 3289, 3289, 3288, 3288, 3288, 3287, 3287, 3287, 3286, 3286,
+    3285, 3285, 3285, 3284, 3284, 3284, 3283, 3283, 3283, 3282, 3282, 3282, -1313, -1313, -2844, -2844,
+    -2844, -2843, -2843, -2843, -2842, -2842, -2842, -2842, -2841, -2841, -2841, -2840, -2840, -2840, -2839, -2839,
+    -2839, -2839, -2838, -2838, -2838, -2837, -2837, -2837, -2836, -2836, -2836, -2835, -2835, -2835, -2835, -2834,
+    -2834, -2834, -2833, -2833, -1964, -1963, 4120, 4119, 4119, 4119, 4118, 4118, 4117, 4117, 4116, 4116,
+    4115, 4115, 4115, 4114, 4114, 4113, 4113, 4112, 4112, 4111, 4111, 4111, 4110, 4110, 4109, 4109,
+    4108, 4108, 4107, 4107, 4107, 4106, 4106, 4105, 4105, 4104, 4104, 4103, 4103, 4103, 1306, 1305,
+    1305, 1305, 1305, 1305, 1305, 1305, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1303, 1303, 1303,
+    1303, 1303, 1303, 1303, 1303, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1301, 1301, 1301, 1301,
+    1301, 1301, 1301, 1300, 1300, 1300, 853, 853, 853, 853, 852, 852, 852, 852, 852, 852,
+    852, 852, 852, 852, 852, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851, 851,
+    850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 850, 849, 3124, 3124, 3881, 3881,
+    3880, 3880, 3880, 3879, 3879, 3878, 3878, 3877, 3877, 3877, 3876, 3876, 3875, 3875, 3875, 3874,
+    3874, 3873, 3873, 3872, 3872, 3872, 3871, 3871, 3870, 3870, 3869, 3869, 3869, 3868, 3868, 3867,
+    3867, 3867, 3866, 3866, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+    75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 3337, 3337, 3336, 3336, 3336, 3335,
+    3335, 3334, 3334, 3334, 3333, 3333, 3333, 3332, 3332, 3332, 3331, 3331, 3330, 3330, 3330, 3329,
+    3329, 3329, 3328, 3328, 3328, 3327, 3327, 3326, 3326, 3326, 3325, 3325, 3325, 3324, 3324, 3323,
+    4981, 4980, 4980, 4979, 4979, 4978, 4978, 4977, 4976, 4976, 4975, 4975, 4974, 4974, 4973, 4973,
+    4972, 4971, 4971, 4970, 4970, 4969, 4969, 4968, 4968, 4967, 4967, 4966, 4965, 4965, 4964, 4964,
+    4963, 4963, 4962, 4962, 4961, 4961, -3452, -3452, -3452, -3451, -3451, -3450, -3450, -3450, -3449, -3449,
+    -3448, -3448, -3448, -3447, -3447, -3447, -3446, -3446, -3445, -3445, -3445, -3444, -3444, -3444, -3443, -3443,
+    -3442, -3442, -3442, -3441, -3441, -3440, -3440, -3440, -3439, -3439, -3439, -3438, 3301, 3301, 3301, 3300,
+    3300, 3299, 3299, 3299, 3298, 3298, 3298, 3297, 3297, 3297, 3296, 3296, 3295, 3295, 3295, 3294,
+    3294, 3294, 3293, 3293, 3292, 3292, 3292, 3291, 3291, 3291, 3290, 3290, 3290, 3289, 3289, 3288,
+    102, 102, -353, -353, -353, -353, -353, -353, -353, -353, -352, -352, -352, -352, -352, -352,
+    -352, -352, -352, -352, -352, -352, -352, -352, -352, -352, -352, -352, -352, -352, -352, -352,
+    -352, -352, -352, -351, -288, -288, -97, -97, -97, -97, -97, -97, -97, -97, -97, -97,
+    -97, -97, -97, -97, -97, -97, -97, -97, -97, -97, -97, -97, -97, -97, -97, -97,
+    -97, -97, -97, -97, -97, -97, -97, -97, -97, -97, 2810, 2809, 2809, 2809, 2809, 2808,
+    2808, 2808, 2807, 2807, 2807, 2806, 2806, 2806, 2805, 2805, 2805, 2804, 2804, 2804, 2804, 2803,
+    2803, 2803, 2802, 2802, 2802, 2801, 2801, 2801, 2800, 2800, 2800, 2799, 2799, 2799, 3845, 3845,
+    3844, 3844, 3843, 3843, 3842, 3842, 3841, 3841, 3841, 3840, 3840, 3839, 3839, 3838, 3838, 3838,
+    3837, 3837, 3836, 3836, 3835, 3835, 3835, 3834, 3834, 3833, 3833, 3832, 3832, 3832, 3831, 3831,
+    4450, 4449, 6307, 6306, 6306, 6305, 6304, 6303, 6303, 6302, 6301, 6301, 6300, 6299, 6298, 6298,
+    6297, 6296, 6296, 6295, 6294, 6293, 6293, 6292, 6291, 6291, 6290, 6289, 6288, 6288, 6287, 6286,
+    6286, 6285, 6284, 6283, -2382, -2382, -2381, -2381, -2381, -2380, -2380, -2380, -2380, -2379, -2379, -2379,
+    -2379, -2378, -2378, -2378, -2377, -2377, -2377, -2377, -2376, -2376, -2376, -2376, -2375, -2375, -2375, -2374,
+    -2374, -2374, -2374, -2373, -2373, -2373, -2373, -2372, -1622, -1622, -1621, -1621, -1621, -1621, -1621, -1621,
+    -1620, -1620, -1620, -1620, -1620, -1619, -1619, -1619, -1619, -1619, -1619, -1618, -1618, -1618, -1618, -1618,
+    -1617, -1617, -1617, -1617, -1617, -1616, -1616, -1616, -1616, -1616, 6313, 6312, 6311, 6310, 6310, 6309,
+    6308, 6307, 6307, 6306, 6305, 6305, 6304, 6303, 6302, 6302, 6301, 6300, 6300, 6299, 6298, 6297,
+    6297, 6296, 6295, 6294, 6294, 6293, 6292, 6292, 6291, 6290, 6289, 6289, -3155, -3155, -3155, -3154,
+    -3154, -3153, -3153, -3153, -3152, -3152, -3152, -3151, -3151, -3151, -3150, -3150, -3150, -3149, -3149, -3148,
+    -3148, -3148, -3147, -3147, -3147, -3146, -3146, -3146, -3145, -3145, -3144, -3144, -3144, -3143, -165, -165,
+    -165, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164,
+    -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164, -164,
+    1889, 1889, 1888, 1888, 1888, 1888, 1887, 1887, 1887, 1887, 1887, 1886, 1886, 1886, 1886, 1885,
+    1885, 1885, 1885, 1885, 1884, 1884, 1884, 1884, 1883, 1883, 1883, 1883, 1883, 1882, 1882, 1882,
+    1882, 1882, -3410, -3410, -3410, -3409, -3409, -3408, -3408, -3408, -3407, -3407, -3406, -3406, -3406, -3405,
+    -3405, -3404, -3404, -3404, -3403, -3403, -3402, -3402, -3402, -3401, -3401, -3401, -3400, -3400, -3399, -3399,
+    -3399, -3398, -4985, -4984, -5936, -5935, -5934, -5934, -5933, -5932, -5932, -5931, -5930, -5930, -5929, -5928,
+    -5928, -5927, -5926, -5925, -5925, -5924, -5923, -5923, -5922, -5921, -5921, -5920, -5919, -5919, -5918, -5917,
+    -5916, -5916, -5915, -5914, -1271, -1271, -1271, -1271, -1271, -1271, -1271, -1270, -1270, -1270, -1270, -1270,
+    -1270, -1270, -1269, -1269, -1269, -1269, -1269, -1269, -1268, -1268, -1268, -1268, -1268, -1268, -1268, -1267,
+    -1267, -1267, -1267, -1267, 676, 676, 676, 675, 675, 675, 675, 675, 675, 675, 675, 675,
+    675, 675, 675, 675, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674, 674,
+    673, 673, 673, 673, -195, -195, -195, -195, -195, -195, -195, -195, -195, -195, -195, -195,
+    -195, -195, -195, -195, -195, -195, -195, -194, -194, -194, -194, -194, -194, -194, -194, -194,
+    -194, -194, -194, -194, 4010, 4010, 4610, 4609, 4609, 4608, 4608, 4607, 4607, 4606, 4605, 4605,
+    4604, 4604, 4603, 4603, 4602, 4602, 4601, 4601, 4600, 4599, 4599, 4598, 4598, 4597, 4597, 4596,
+    4596, 4595, 4595, 4594, -2090, -2090, -2089, -2089, -2089, -2089, -2088, -2088, -2088, -2088, -2087, -2087,
+    -2087, -2087, -2086, -2086, -2086, -2086, -2085, -2085, -2085, -2085, -2084, -2084, -2084, -2084, -2083, -2083,
+    -2083, -2083, -2082, -2082, -2082, -2082, -2081, -2081, -217, -217, 1646, 1646, 1646, 1645, 1645, 1645,
+    1645, 1645, 1645, 1644, 1644, 1644, 1644, 1644, 1643, 1643, 1643, 1643, 1643, 1642, 1642, 1642,
+    1642, 1642, 1641, 1641, 1641, 1641, 1641, 1640, 1640, 1640, 1640, 1640, 1166, 1166, -255, -255,
+    -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255,
+    -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -255, -254, -254, -254,
+    -1364, -1364, -3214, -3213, -3213, -3213, -3212, -3212, -3212, -3211, -3211, -3210, -3210, -3210, -3209, -3209,
+    -3208, -3208, -3208, -3207, -3207, -3207, -3206, -3206, -3205, -3205, -3205, -3204, -3204, -3203, -3203, -3203,
+    -3202, -3202, -3201, -3201, 4518, 4518, 5620, 5619, 5618, 5618, 5617, 5616, 5616, 5615, 5614, 5614,
+    5613, 5612, 5611, 5611, 5610, 5609, 5609, 5608, 5607, 5607, 5606, 5605, 5605, 5604, 5603, 5603,
+    5602, 5601, 5601, 5600, 5599, 5599, 5598, 5597, 2863, 2862, 2862, 2862, 2861, 2861, 2860, 2860,
+    2860, 2859, 2859, 2859, 2858, 2858, 2858, 2857, 2857, 2857, 2856, 2856, 2856, 2855, 2855, 2855,
+    2854, 2854, 2854, 2853, 2853, 2852, 2852, 2852, 2851, 2851, 910, 909, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262,
+    262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 262, 261, 557, 557, 2628, 2628,
+    2627, 2627, 2627, 2626, 2626, 2626, 2625, 2625, 2625, 2625, 2624, 2624, 2624, 2623, 2623, 2623,
+    2622, 2622, 2622, 2621, 2621, 2621, 2620, 2620, 2620, 2619, 2619, 2619, 2618, 2618, 2618, 2617,
+    4845, 4845, 4844, 4843, 4843, 4842, 4842, 4841, 4840, 4840, 4839, 4839, 4838, 4837, 4837, 4836,
+    4836, 4835, 4834, 4834, 4833, 4833, 4832, 4831, 4831, 4830, 4830, 4829, 4828, 4828, 4827, 4827,
+    4826, 4825, 2712, 2712, 2712, 2711, 2711, 2711, 2710, 2710, 2710, 2709, 2709, 2709, 2708, 2708,
+    2708, 2707, 2707, 2707, 2706, 2706, 2706, 2705, 2705, 2705, 2704, 2704, 2704, 2703, 2703, 2703,
+    2702, 2702, -461, -461, -3623, -3622, -3622, -3621, -3621, -3621, -3620, -3620, -3619, -3619, -3618, -3618,
+    -3617, -3617, -3617, -3616, -3616, -3615, -3615, -3614, -3614, -3613, -3613, -3612, -3612, -3612, -3611, -3611,
+    -3610, -3610, -3609, -3609, 1575, 1575, 1575, 1575, 1574, 1574, 1574, 1574, 1574, 1574, 1573, 1573,
+    1573, 1573, 1573, 1572, 1572, 1572, 1572, 1572, 1571, 1571, 1571, 1571, 1571, 1570, 1570, 1570,
+    1570, 1570, 1569, 1569, 1404, 1404, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,
+    246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246, 246,
+    246, 246, 246, 246, 246, 246, -3620, -3620, -3619, -3619, -3618, -3618, -3617, -3617, -3616, -3616,
+    -3616, -3615, -3615, -3614, -3614, -3613, -3613, -3612, -3612, -3611, -3611, -3611, -3610, -3610, -3609, -3609,
+    -3608, -3608, -3607, -3607, -3606, -3606, 1959, 1959, 1959, 1958, 1958, 1958, 1958, 1957, 1957, 1957,
+    1957, 1956, 1956, 1956, 1956, 1955, 1955, 1955, 1955, 1954, 1954, 1954, 1954, 1953, 1953, 1953,
+    1953, 1952, 1952, 1952, 1952, 1951, -2224, -2224, -2820, -2820, -2820, -2819, -2819, -2819, -2818, -2818,
+    -2817, -2817, -2817, -2816, -2816, -2816, -2815, -2815, -2815, -2814, -2814, -2814, -2813, -2813, -2812, -2812,
+    -2812, -2811, -2811, -2811, -2810, -2810, 4221, 4220, 4220, 4219, 4219, 4218, 4218, 4217, 4217, 4216,
+    4216, 4215, 4214, 4214, 4213, 4213, 4212, 4212, 4211, 4211, 4210, 4210, 4209, 4209, 4208, 4207,
+    4207, 4206, 4206, 4205, 4205, 4204, -5088, -5088, -5087, -5086, -5086, -5085, -5084, -5084, -5083, -5082,
+    -5082, -5081, -5080, -5080, -5079, -5078, -5078, -5077, -5076, -5076, -5075, -5075, -5074, -5073, -5073, -5072,
+    -5071, -5071, -5070, -5069, -5069, -5068, 3145, 3145, 3145, 3144, 3144, 3143, 3143, 3143, 3142, 3142,
+    3141, 3141, 3141, 3140, 3140, 3139, 3139, 3139, 3138, 3138, 3137, 3137, 3136, 3136, 3136, 3135,
+    3135, 3134, 3134, 3134, -3404, -3404, -3403, -3403, -3403, -3402, -3402, -3401, -3401, -3400, -3400, -3399,
+    -3399, -3399, -3398, -3398, -3397, -3397, -3396, -3396, -3396, -3395, -3395, -3394, -3394, -3393, -3393, -3392,
+    -3392, -3392, -3391, -3391, -4626, -4626, -4625, -4624, -4624, -4623, -4623, -4622, -4621, -4621, -4620, -4620,
+    -4619, -4618, -4618, -4617, -4617, -4616, -4615, -4615, -4614, -4614, -4613, -4612, -4612, -4611, -4611, -4610,
+    -4609, -4609, -2397, -2397, -2397, -2396, -2396, -2396, -2395, -2395, -2395, -2394, -2394, -2394, -2394, -2393,
+    -2393, -2393, -2392, -2392, -2392, -2391, -2391, -2391, -2390, -2390, -2390, -2390, -2389, -2389, -2389, -2388,
+    2117, 2117, 2116, 2116, 2116, 2115, 2115, 2115, 2115, 2114, 2114, 2114, 2114, 2113, 2113, 2113,
+    2112, 2112, 2112, 2112, 2111, 2111, 2111, 2110, 2110, 2110, 2110, 2109, 2109, 2109, -4580, -4579,
+    -4578, -4578, -4577, -4577, -4576, -4575, -4575, -4574, -4574, -4573, -4572, -4572, -4571, -4571, -4570, -4569,
+    -4569, -4568, -4568, -4567, -4566, -4566, -4565, -4565, -4564, -4563, -4563, -4562, -257, -257, -257, -257,
+    -257, -257, -257, -257, -257, -257, -257, -257, -257, -257, -257, -257, -257, -257, -257, -257,
+    -257, -257, -257, -257, -257, -257, -256, -256, -256, -256, -2783, -2783, -2782, -2782, -2782, -2781,
+    -2781, -2781, -2780, -2780, -2779, -2779, -2779, -2778, -2778, -2778, -2777, -2777, -2777, -2776, -2776, -2775,
+    -2775, -2775, -2774, -2774, -2774, -2773, -1591, -1591, 1954, 1953, 1953, 1953, 1953, 1952, 1952, 1952,
+    1952, 1951, 1951, 1951, 1951, 1950, 1950, 1950, 1950, 1949, 1949, 1949, 1948, 1948, 1948, 1948,
+    1947, 1947, 1947, 1947, 568, 568, 568, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+    567, 567, 567, 567, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+    1103, 1103, 4867, 4866, 4866, 4865, 4864, 4864, 4863, 4862, 4862, 4861, 4860, 4860, 4859, 4858,
+    4858, 4857, 4856, 4856, 4855, 4855, 4854, 4853, 4853, 4852, 4851, 4851, 4850, 4849, 610, 610,
+    610, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 608, 608, 608,
+    608, 608, 608, 608, 608, 608, 608, 608, 608, 608, -3434, -3433, -4010, -4009, -4009, -4008,
+    -4008, -4007, -4007, -4006, -4006, -4005, -4005, -4004, -4003, -4003, -4002, -4002, -4001, -4001, -4000, -4000,
+    -3999, -3999, -3998, -3998, -3997, -3996, -1590, -1590, 816, 816, 816, 816, 816, 815, 815, 815,
+    815, 815, 815, 815, 815, 815, 814, 814, 814, 814, 814, 814, 814, 814, 814, 813,
+    813, 813, 1252, 1252, 1691, 1691, 1690, 1690, 1690, 1690, 1690, 1689, 1689, 1689, 1689, 1688,
+    1688, 1688, 1688, 1688, 1687, 1687, 1687, 1687, 1686, 1686, 1686, 1686, 1685, 1685, 1685, 1685,
+    1685, 1684, -1527, -1527, -3453, -3453, -3452, -3452, -3451, -3451, -3450, -3450, -3449, -3449, -3448, -3448,
+    -3448, -3447, -3447, -3446, -3446, -3445, -3445, -3444, -3444, -3443, -3443, -3442, -3442, -3441, -3441, -3440,
+    -3440, -3440, 1394, 1394, 1393, 1393, 1393, 1393, 1393, 1393, 1392, 1392, 1392, 1392, 1392, 1391,
+    1391, 1391, 1391, 1391, 1390, 1390, 1390, 1390, 1390, 1389, 1389, 1389, 1389, 1389, 1389, 1388,
+    1388, 1388, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429, 429,
+    429, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 428,
+    -3871, -3871, -5303, -5302, -5302, -5301, -5300, -5299, -5299, -5298, -5297, -5296, -5296, -5295, -5294, -5294,
+    -5293, -5292, -5291, -5291, -5290, -5289, -5288, -5288, -5287, -5286, -5285, -5285, -5284, -5283, -5283, -5282,
+    2375, 2375, 2375, 2374, 2374, 2374, 2373, 2373, 2373, 2372, 2372, 2372, 2371, 2371, 2371, 2370,
+    2370, 2370, 2369, 2369, 2369, 2368, 2368, 2368, 2367, 2367, 2367, 2366, 2366, 2366, -2096, -2095,
+    -2095, -2095, -2094, -2094, -2094, -2094, -2093, -2093, -2093, -2092, -2092, -2092, -2092, -2091, -2091, -2091,
+    -2090, -2090, -2090, -2090, -2089, -2089, -2089, -2088, -2088, -2088, -2087, -2087, -4995, -4994, -4993, -4993,
+    -4992, -4991, -4990, -4990, -4989, -4988, -4988, -4987, -4986, -4986, -4985, -4984, -4983, -4983, -4982, -4981,
+    -4981, -4980, -4979, -4979, -4978, -4977, -4976, -4976, -4975, -4974, 1821, 1820, 1820, 1820, 1820, 1819,
+    1819, 1819, 1818, 1818, 1818, 1818, 1817, 1817, 1817, 1817, 1816, 1816, 1816, 1816, 1815, 1815,
+    1815, 1815, 1814, 1814, 1814, 1814, 1813, 1813, 4097, 4097, 4096, 4095, 4095, 4094, 4094, 4093,
+    4092, 4092, 4091, 4091, 4090, 4090, 4089, 4088, 4088, 4087, 4087, 4086, 4086, 4085, 4084, 4084,
+    4083, 4083, 4082, 4082, 4081, 4080, -2831, -2831, -2830, -2830, -2829, -2829, -2829, -2828, -2828, -2827,
+    -2827, -2827, -2826, -2826, -2825, -2825, -2825, -2824, -2824, -2823, -2823, -2823, -2822, -2822, -2821, -2821,
+    -2821, -2820, 548, 547, 1669, 1669, 1669, 1669, 1669, 1668, 1668, 1668, 1668, 1667, 1667, 1667,
+    1667, 1666, 1666, 1666, 1666, 1665, 1665, 1665, 1665, 1665, 1664, 1664, 1664, 1664, 1663, 1663,
+    4695, 4695, 4694, 4693, 4693, 4692, 4691, 4691, 4690, 4689, 4689, 4688, 4687, 4687, 4686, 4685,
+    4685, 4684, 4683, 4683, 4682, 4681, 4680, 4680, 4679, 4678, 4678, 4677, 209, 209, -429, -429,
+    -429, -429, -428, -428, -428, -428, -428, -428, -428, -428, -428, -428, -428, -428, -428, -428,
+    -428, -428, -427, -427, -427, -427, -427, -427, 608, 608, 3714, 3714, 3713, 3713, 3712, 3712,
+    3711, 3710, 3710, 3709, 3709, 3708, 3708, 3707, 3707, 3706, 3706, 3705, 3705, 3704, 3704, 3703,
+    3702, 3702, 3701, 3701, 3700, 3700, -1153, -1153, -1152, -1152, -1152, -1152, -1152, -1152, -1151, -1151,
+    -1151, -1151, -1151, -1151, -1150, -1150, -1150, -1150, -1150, -1150, -1149, -1149, -1149, -1149, -1149, -1149,
+    -1148, -1148, 2464, 2463, 2463, 2463, 2462, 2462, 2462, 2461, 2461, 2461, 2460, 2460, 2459, 2459,
+    2459, 2458, 2458, 2458, 2457, 2457, 2457, 2456, 2456, 2456, 2455, 2455, 2454, 2454, -3155, -3155,
+    -3154, -3154, -3154, -3153, -3153, -3152, -3152, -3151, -3151, -3150, -3150, -3149, -3149, -3148, -3148, -3148,
+    -3147, -3147, -3146, -3146, -3145, -3145, -3144, -3144, -2774, -2774, -189, -189, -189, -189, -189, -189,
+    -189, -189, -189, -189, -189, -189, -189, -189, -189, -189, -189, -189, -188, -188, -188, -188,
+    -188, -188, -188, -188, 1873, 1873, 3934, 3933, 3933, 3932, 3932, 3931, 3930, 3930, 3929, 3929,
+    3928, 3928, 3927, 3926, 3926, 3925, 3925, 3924, 3924, 3923, 3922, 3922, 3921, 3921, 3920, 3919,
+    -863, -863, -863, -863, -863, -863, -863, -862, -862, -862, -862, -862, -862, -862, -862, -861,
+    -861, -861, -861, -861, -861, -861, -861, -860, -860, -860, -860, -860, -3732, -3731, -3731, -3730,
+    -3730, -3729, -3729, -3728, -3728, -3727, -3727, -3726, -3725, -3725, -3724, -3724, -3723, -3723, -3722, -3722,
+    -3721, -3720, -3720, -3719, -3719, -3718, 2967, 2966, 2966, 2965, 2965, 2964, 2964, 2964, 2963, 2963,
+    2962, 2962, 2961, 2961, 2960, 2960, 2960, 2959, 2959, 2958, 2958, 2957, 2957, 2957, 2956, 2956,
+    3421, 3421, 4819, 4818, 4817, 4817, 4816, 4815, 4814, 4814, 4813, 4812, 4812, 4811, 4810, 4809,
+    4809, 4808, 4807, 4807, 4806, 4805, 4804, 4804, 4803, 4802, 4802, 4801, 3278, 3277, 3277, 3276,
+    3276, 3275, 3275, 3274, 3274, 3273, 3273, 3272, 3272, 3271, 3271, 3270, 3270, 3269, 3269, 3269,
+    3268, 3268, 3267, 3267, 3266, 3266, 2519, 2519, 2518, 2518, 2517, 2517, 2517, 2516, 2516, 2516,
+    2515, 2515, 2514, 2514, 2514, 2513, 2513, 2513, 2512, 2512, 2511, 2511, 2511, 2510, 2510, 2509,
+    4736, 4735, 4734, 4734, 4733, 4732, 4731, 4731, 4730, 4729, 4729, 4728, 4727, 4726, 4726, 4725,
+    4724, 4724, 4723, 4722, 4722, 4721, 4720, 4719, 4719, 4718, -4254, -4254, -4253, -4253, -4252, -4251,
+    -4251, -4250, -4249, -4249, -4248, -4247, -4247, -4246, -4245, -4245, -4244, -4244, -4243, -4242, -4242, -4241,
+    -4240, -4240, -4239, -4238, -4621, -4620, -4619, -4619, -4618, -4617, -4617, -4616, -4615, -4615, -4614, -4613,
+    -4612, -4612, -4611, -4610, -4610, -4609, -4608, -4608, -4607, -4606, -4605, -4605, -4604, -4603, 1332, 1331,
+    1331, 1331, 1331, 1331, 1330, 1330, 1330, 1330, 1330, 1329, 1329, 1329, 1329, 1329, 1328, 1328,
+    1328, 1328, 1328, 1327, 1327, 1327, 741, 741, -3356, -3356, -3355, -3355, -3354, -3354, -3353, -3353,
+    -3352, -3352, -3351, -3351, -3350, -3350, -3349, -3349, -3348, -3347, -3347, -3346, -3346, -3345, -3345, -3344,
+    -2127, -2126, -1952, -1952, -1952, -1951, -1951, -1951, -1951, -1950, -1950, -1950, -1949, -1949, -1949, -1948,
+    -1948, -1948, -1948, -1947, -1947, -1947, -1946, -1946, -1946, -1945, 2109, 2108, 2108, 2108, 2108, 2107,
+    2107, 2107, 2106, 2106, 2106, 2105, 2105, 2105, 2104, 2104, 2104, 2103, 2103, 2103, 2102, 2102,
+    2102, 2101, 2101, 2101, 2100, 2100, -2732, -2732, -2731, -2731, -2731, -2730, -2730, -2729, -2729, -2728,
+    -2728, -2728, -2727, -2727, -2726, -2726, -2725, -2725, -2725, -2724, -2724, -2723, -2723, -2723, -2722, -2722,
+    -2721, -2721, -2242, -2241, -2241, -2241, -2240, -2240, -2240, -2239, -2239, -2239, -2238, -2238, -2238, -2237,
+    -2237, -2237, -2236, -2236, -2236, -2235, -2235, -2234, -2234, -2234, -2233, -2233, -2233, -2232, -3305, -3305,
+    -3304, -3304, -3303, -3303, -3302, -3302, -3301, -3301, -3300, -3300, -3299, -3299, -3298, -3298, -3297, -3297,
+    -3296, -3295, -3295, -3294, -3294, -3293, -3293, -3292, 1189, 1189, 3876, 3876, 3875, 3874, 3874, 3873,
+    3873, 3872, 3871, 3871, 3870, 3870, 3869, 3868, 3868, 3867, 3866, 3866, 3865, 3865, 3864, 3863,
+    3863, 3862, 3862, 3861, -3521, -3521, -3520, -3520, -3519, -3519, -3518, -3517, -3517, -3516, -3516, -3515,
+    -3515, -3514, -3514, -3513, -3512, -3512, -3511, -3511, -3510, -3510, -3509, -3509, -3508, -3507, -2843, -2842,
+    -849, -849, -849, -849, -849, -849, -849, -848, -848, -848, -848, -848, -848, -848, -848, -847,
+    -847, -847, -847, -847, -847, -847, -846, -846, -846, -846, -3519, -3518, -3518, -3517, -3516, -3516,
+    -3515, -3515, -3514, -3514, -3513, -3513, -3512, -3511, -3511, -3510, -3510, -3509, -3509, -3508, -3507, -3507,
+    -3506, -3506, -3505, -3505, -2517, -2517, -2188, -2187, -2187, -2187, -2186, -2186, -2186, -2185, -2185, -2185,
+    -2184, -2184, -2184, -2183, -2183, -2183, -2182, -2182, -2182, -2181, -2181, -2180, -2180, -2180, -924, -924,
+    2840, 2839, 2839, 2838, 2838, 2837, 2837, 2836, 2836, 2835, 2835, 2834, 2834, 2834, 2833, 2833,
+    2832, 2832, 2831, 2831, 2830, 2830, 2829, 2829, 2829, 2828, 1507, 1506, 1506, 1506, 1506, 1506,
+    1505, 1505, 1505, 1505, 1504, 1504, 1504, 1504, 1503, 1503, 1503, 1503, 1502, 1502, 1502, 1502,
+    1501, 1501, 1501, 1501, -2297, -2297, -2297, -2296, -2296, -2296, -2295, -2295, -2294, -2294, -2294, -2293,
+    -2293, -2293, -2292, -2292, -2291, -2291, -2291, -2290, -2290, -2290, -2289, -2289, -2288, -2288, 1661, 1661,
+    1661, 1661, 1660, 1660, 1660, 1659, 1659, 1659, 1659, 1658, 1658, 1658, 1658, 1657, 1657, 1657,
+    1656, 1656, 1656, 1656, 1655, 1655, 1001, 1001, -961, -961, -961, -961, -960, -960, -960, -960,
+    -960, -960, -959, -959, -959, -959, -959, -959, -959, -958, -958, -958, -958, -958, -958, -957,
+    -3732, -3731, -4655, -4654, -4654, -4653, -4652, -4651, -4651, -4650, -4649, -4648, -4648, -4647, -4646, -4645,
+    -4644, -4644, -4643, -4642, -4641, -4641, -4640, -4639, -4638, -4638, 1067, 1067, 1067, 1067, 1067, 1066,
+    1066, 1066, 1066, 1066, 1066, 1065, 1065, 1065, 1065, 1065, 1065, 1064, 1064, 1064, 1064, 1064,
+    1064, 1063, 1040, 1040, 876, 876, 876, 876, 876, 876, 876, 875, 875, 875, 875, 875,
+    875, 875, 874, 874, 874, 874, 874, 874, 874, 873, 873, 873, 2097, 2097, 2096, 2096,
+    2096, 2095, 2095, 2095, 2094, 2094, 2093, 2093, 2093, 2092, 2092, 2092, 2091, 2091, 2091, 2090,
+    2090, 2090, 2089, 2089, 1318, 1318, -4074, -4074, -4073, -4072, -4072, -4071, -4070, -4070, -4069, -4068,
+    -4068, -4067, -4066, -4066, -4065, -4064, -4064, -4063, -4062, -4062, -4061, -4060, -4060, -4059, -1747, -1747,
+    -1746, -1746, -1746, -1745, -1745, -1745, -1745, -1744, -1744, -1744, -1743, -1743, -1743, -1742, -1742, -1742,
+    -1742, -1741, -1741, -1741, -1740, -1740, -492, -492, -491, -491, -491, -491, -491, -491, -491, -491,
+    -491, -491, -491, -491, -491, -490, -490, -490, -490, -490, -490, -490, -490, -490, 2329, 2329,
+    4019, 4018, 4018, 4017, 4016, 4016, 4015, 4014, 4014, 4013, 4012, 4012, 4011, 4010, 4010, 4009,
+    4008, 4007, 4007, 4006, 4005, 4005, 2489, 2489, -36, -36, -36, -36, -36, -36, -36, -36,
+    -36, -36, -36, -36, -36, -36, -36, -36, -36, -36, -36, -36, -36, -36, 312, 312,
+    1353, 1353, 1352, 1352, 1352, 1352, 1351, 1351, 1351, 1351, 1351, 1350, 1350, 1350, 1350, 1349,
+    1349, 1349, 1349, 1348, 1348, 1348, 1153, 1153, 828, 828, 827, 827, 827, 827, 827, 827,
+    827, 826, 826, 826, 826, 826, 826, 826, 825, 825, 825, 825, 825, 825, -1849, -1849,
+    -3453, -3452, -3451, -3451, -3450, -3450, -3449, -3448, -3448, -3447, -3447, -3446, -3446, -3445, -3444, -3444,
+    -3443, -3443, -3442, -3441, -3441, -3440, -1811, -1811, -1810, -1810, -1810, -1810, -1809, -1809, -1809, -1808,
+    -1808, -1808, -1807, -1807, -1807, -1806, -1806, -1806, -1806, -1805, -1805, -1805, -1804, -1804, -3167, -3166,
+    -3166, -3165, -3165, -3164, -3164, -3163, -3162, -3162, -3161, -3161, -3160, -3160, -3159, -3159, -3158, -3158,
+    -3157, -3156, -3156, -3155, -3126, -3126, -2925, -2925, -2924, -2924, -2923, -2923, -2922, -2922, -2921, -2921,
+    -2920, -2920, -2919, -2919, -2918, -2918, -2917, -2917, -2916, -2916, -2915, -2915, -463, -463, -463, -463,
+    -463, -463, -463, -463, -462, -462, -462, -462, -462, -462, -462, -462, -462, -462, -462, -462,
+    -461, -461, -461, -461, -2589, -2588, -2588, -2587, -2587, -2587, -2586, -2586, -2585, -2585, -2584, -2584,
+    -2583, -2583, -2582, -2582, -2582, -2581, -2581, -2580, -2580, -2579, 1290, 1290, 1289, 1289, 1289, 1289,
+    1288, 1288, 1288, 1288, 1287, 1287, 1287, 1287, 1287, 1286, 1286, 1286, 1286, 1285, 1285, 1285,
+    231, 231, -2930, -2929, -2929, -2928, -2928, -2927, -2927, -2926, -2926, -2925, -2925, -2924, -2924, -2923,
+    -2923, -2922, -2922, -2921, -2920, -2920, -2919, -2919, -2918, -2918, 567, 567, 567, 567, 567, 567,
+    567, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 565, 565, 565, 565, 565,
+    565, 565, 926, 926, 3451, 3451, 3450, 3450, 3449, 3448, 3448, 3447, 3446, 3446, 3445, 3445,
+    3444, 3443, 3443, 3442, 3442, 3441, 3440, 3440, 3439, 3438, 3438, 3437, -2758, -2758, -2757, -2757,
+    -2756, -2756, -2755, -2755, -2754, -2754, -2753, -2753, -2752, -2752, -2751, -2751, -2750, -2750, -2749, -2749,
+    -2748, -2748, -2747, -2747, -2948, -2947, -3068, -3067, -3067, -3066, -3066, -3065, -3064, -3064, -3063, -3063,
+    -3062, -3062, -3061, -3061, -3060, -3059, -3059, -3058, -3058, -3057, -3057, -3056, -2145, -2144, 4230, 4229,
+    4229, 4228, 4227, 4226, 4226, 4225, 4224, 4223, 4222, 4222, 4221, 4220, 4219, 4219, 4218, 4217,
+    4216, 4216, 4215, 4214, 4213, 4213, 1242, 1242, 1241, 1241, 1241, 1241, 1240, 1240, 1240, 1240,
+    1240, 1239, 1239, 1239, 1239, 1238, 1238, 1238, 1238, 1238, 1237, 1237, 1237, 1237, 2873, 2873,
+    2872, 2872, 2871, 2871, 2870, 2870, 2869, 2869, 2868, 2868, 2867, 2866, 2866, 2865, 2865, 2864,
+    2864, 2863, 2863, 2862, 2862, 2861, -539, -539, -539, -539, -538, -538, -538, -538, -538, -538,
+    -538, -538, -538, -538, -537, -537, -537, -537, -537, -537, -537, -537, -537, -537, 404, 404,
+    404, 404, 404, 404, 404, 404, 404, 403, 403, 403, 403, 403, 403, 403, 403, 403,
+    403, 403, 403, 403, 1075, 1075, 3092, 3092, 3091, 3091, 3090, 3090, 3089, 3088, 3088, 3087,
+    3087, 3086, 3086, 3085, 3084, 3084, 3083, 3083, 3082, 3082, 3081, 3080, -2301, -2301, -4094, -4093,
+    -4092, -4091, -4091, -4090, -4089, -4088, -4088, -4087, -4086, -4085, -4085, -4084, -4083, -4082, -4082, -4081,
+    -4080, -4079, -4079, -4078, 3857, 3856, 3855, 3855, 3854, 3853, 3853, 3852, 3851, 3850, 3850, 3849,
+    3848, 3848, 3847, 3846, 3845, 3845, 3844, 3843, 3843, 3842, 3551, 3550, 1519, 1519, 1519, 1519,
+    1518, 1518, 1518, 1517, 1517, 1517, 1517, 1516, 1516, 1516, 1515, 1515, 1515, 1515, 1514, 1514,
+    1514, 1513, 1210, 1210, 1210, 1210, 1210, 1209, 1209, 1209, 1209, 1208, 1208, 1208, 1208, 1208,
+    1207, 1207, 1207, 1207, 1206, 1206, 1206, 1206, 551, 551, -4025, -4024, -4024, -4023, -4022, -4021,
+    -4021, -4020, -4019, -4018, -4018, -4017, -4016, -4015, -4015, -4014, -4013, -4012, -4012, -4011, -4010, -4009,
+    -2601, -2600, -2600, -2599, -2599, -2598, -2598, -2597, -2597, -2596, -2596, -2595, -2595, -2594, -2594, -2593,
+    -2593, -2592, -2592, -2591, -2591, -2590, -2890, -2890, -3070, -3069, -3069, -3068, -3067, -3067, -3066, -3066,
+    -3065, -3064, -3064, -3063, -3063, -3062, -3062, -3061, -3060, -3060, -3059, -3059, -2832, -2831, -1249, -1248,
+    -1248, -1248, -1248, -1247, -1247, -1247, -1247, -1246, -1246, -1246, -1246, -1246, -1245, -1245, -1245, -1245,
+    -1244, -1244, -1244, -1244, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 1345, 1345, 1344, 1344, 1344, 1344,
+    1343, 1343, 1343, 1343, 1342, 1342, 1342, 1342, 1341, 1341, 1341, 1341, 1340, 1340, 1340, 1340,
+    -180, -180, -180, -180, -180, -180, -180, -180, -180, -180, -180, -180, -180, -180, -180, -180,
+    -180, -180, -180, -180, -180, -180, -1893, -1893, -1892, -1892, -1892, -1891, -1891, -1891, -1890, -1890,
+    -1889, -1889, -1889, -1888, -1888, -1888, -1887, -1887, -1887, -1886, -1886, -1885, -3233, -3232, -3232, -3231,
+    -3230, -3230, -3229, -3228, -3228, -3227, -3226, -3226, -3225, -3225, -3224, -3223, -3223, -3222, -3221, -3221,
+    -3220, -3220, -3531, -3531, -3530, -3529, -3528, -3528, -3527, -3526, -3526, -3525, -3524, -3524, -3523, -3522,
+    -3522, -3521, -3520, -3520, -3519, -3518, -3550, -3549, -3777, -3776, -3776, -3775, -3774, -3773, -3773, -3772,
+    -3771, -3770, -3770, -3769, -3768, -3768, -3767, -3766, -3765, -3765, -3764, -3763, -283, -283, 876, 876,
+    876, 876, 876, 875, 875, 875, 875, 875, 875, 874, 874, 874, 874, 874, 874, 873,
+    873, 873, -370, -370, -370, -370, -370, -370, -370, -370, -370, -370, -369, -369, -369, -369,
+    -369, -369, -369, -369, -369, -369, -369, -369, 1223, 1222, 1222, 1222, 1222, 1221, 1221, 1221,
+    1221, 1220, 1220, 1220, 1220, 1219, 1219, 1219, 1219, 1218, 1218, 1218, 3539, 3539, 3538, 3537,
+    3536, 3536, 3535, 3534, 3534, 3533, 3532, 3531, 3531, 3530, 3529, 3529, 3528, 3527, 3527, 3526,
+    3525, 3524, 1275, 1275, 1275, 1275, 1274, 1274, 1274, 1274, 1273, 1273, 1273, 1273, 1272, 1272,
+    1272, 1271, 1271, 1271, 1271, 1270, -2232, -2231, -2231, -2230, -2230, -2229, -2229, -2228, -2228, -2228,
+    -2227, -2227, -2226, -2226, -2225, -2225, -2224, -2224, -2223, -2223, -2302, -2302, -2433, -2433, -2432, -2432,
+    -2431, -2431, -2430, -2430, -2429, -2429, -2429, -2428, -2428, -2427, -2427, -2426, -2426, -2425, -2425, -2424,
+    -2424, -2423, 909, 909, 909, 909, 909, 908, 908, 908, 908, 908, 908, 907, 907, 907,
+    907, 907, 906, 906, 906, 906, 906, 906, 176, 175, 175, 175, 175, 175, 175, 175,
+    175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, -215, -215,
+    -605, -605, -604, -604, -604, -604, -604, -604, -604, -604, -603, -603, -603, -603, -603, -603,
+    -603, -603, -602, -602, -260, -260, 768, 767, 767, 767, 767, 767, 767, 766, 766, 766,
+    766, 766, 766, 765, 765, 765, 765, 765, 765, 765, 764, 764, 2796, 2795, 2794, 2794,
+    2793, 2793, 2792, 2791, 2791, 2790, 2790, 2789, 2789, 2788, 2787, 2787, 2786, 2786, 2785, 2785,
+    2784, 2783, -2795, -2795, -2794, -2793, -2793, -2792, -2792, -2791, -2791, -2790, -2789, -2789, -2788, -2788,
+    -2787, -2787, -2786, -2785, -2785, -2784, -2784, -2783, -1961, -1960, -1960, -1959, -1959, -1959, -1958, -1958,
+    -1957, -1957, -1957, -1956, -1956, -1955, -1955, -1954, -1954, -1954, -1953, -1953, -2103, -2102, -2552, -2551,
+    -2551, -2550, -2550, -2549, -2549, -2548, -2548, -2547, -2547, -2546, -2545, -2545, -2544, -2544, -2543, -2543,
+    -2542, -2542, -2321, -2321, -2188, -2188, -2187, -2187, -2187, -2186, -2186, -2185, -2185, -2184, -2184, -2183,
+    -2183, -2182, -2182, -2181, -2181, -2181, -2180, -2180, -654, -654, -654, -654, -654, -654, -653, -653,
+    -653, -653, -653, -653, -653, -652, -652, -652, -652, -652, -652, -652, -652, -651, 2539, 2538,
+    2537, 2537, 2536, 2536, 2535, 2535, 2534, 2534, 2533, 2533, 2532, 2531, 2531, 2530, 2530, 2529,
+    2529, 2528, 422, 422, -3086, -3085, -3084, -3084, -3083, -3082, -3082, -3081, -3080, -3080, -3079, -3078,
+    -3078, -3077, -3076, -3076, -3075, -3074, -3074, -3073, 1312, 1312, 1312, 1311, 1311, 1311, 1311, 1310,
+    1310, 1310, 1309, 1309, 1309, 1309, 1308, 1308, 1308, 1307, 1307, 1307, 1284, 1283, 1122, 1122,
+    1121, 1121, 1121, 1121, 1120, 1120, 1120, 1120, 1119, 1119, 1119, 1119, 1118, 1118, 1118, 1118,
+    1117, 1117, -3538, -3537, -3536, -3536, -3535, -3534, -3533, -3533, -3532, -3531, -3530, -3530, -3529, -3528,
+    -3527, -3526, -3526, -3525, -3524, -3523, -328, -328, 2866, 2865, 2865, 2864, 2863, 2863, 2862, 2862,
+    2861, 2860, 2860, 2859, 2858, 2858, 2857, 2857, 2856, 2855, 2855, 2854, -975, -975, -975, -975,
+    -975, -974, -974, -974, -974, -973, -973, -973, -973, -973, -972, -972, -972, -972, -972, -971,
+    1286, 1286, 1286, 1285, 1285, 1285, 1285, 1284, 1284, 1284, 1283, 1283, 1283, 1283, 1282, 1282,
+    1282, 1281, 1281, 1281, -100, -100, -560, -560, -560, -560, -560, -560, -560, -560, -559, -559,
+    -559, -559, -559, -559, -559, -559, -559, -558, 947, 947, 2451, 2451, 2450, 2449, 2449, 2448,
+    2448, 2447, 2447, 2446, 2446, 2445, 2445, 2444, 2443, 2443, 2442, 2442, 1355, 1355, -1903, -1903,
+    -1902, -1902, -1901, -1901, -1901, -1900, -1900, -1899, -1899, -1898, -1898, -1898, -1897, -1897, -1896, -1896,
+    -1789, -1789, -1047, -1046, -1046, -1046, -1046, -1045, -1045, -1045, -1045, -1044, -1044, -1044, -1044, -1044,
+    -1043, -1043, -1043, -1043, -1042, -1042, -1740, -1740, -1739, -1739, -1738, -1738, -1738, -1737, -1737, -1736,
+    -1736, -1736, -1735, -1735, -1734, -1734, -1734, -1733, -1701, -1701, -1479, -1478, -1478, -1478, -1477, -1477,
+    -1477, -1476, -1476, -1476, -1475, -1475, -1475, -1474, -1474, -1474, -1473, -1473, -860, -860, 161, 161,
+    -2362, -2362, -2361, -2361, -2360, -2360, -2359, -2359, -2358, -2357, -2357, -2356, -2356, -2355, -2355, -2354,
+    -2354, -2353, -2353, -2352, -2352, -2351, -2350, -2350, -2349, -2349, -2348, -2348, -2347, -2347, -2346, -2346,
+    -2345, -2345, -2344, -2344, -2343, -2342, -2342, -2341, -2341, -2340, -2340, -2339, -2339, -2338, -2338, -2337,
+    -2337, -2336, -2335, -2335, -2334, -2334, -2333, -2333, -2332, -2332, -2331, -2331, -2330, -2330, -2329, -2006,
+    -2006, -2005, -2005, -2004, -2004, -2003, -2003, -2002, -2002, -2001, -2001, -2001, -2000, -2000, -1999, -1999,
+    -1998, -1998, -1997, -1997, -1996, -1996, -1995, -1995, -1995, -1994, -1994, -1993, -1993, -1992, -1992, -1991,
+    -1991, -1990, -1990, -1989, -1989, -1989, -1988, -1988, -1987, -1987, -1986, -1986, -1985, -1985, -1984, -1984,
+    -1983, -1983, -1983, -1982, -1982, -1981, -595, -595, -594, -594, -594, -594, -594, -594, -594, -593,
+    -593, -593, -593, -593, -593, -593, -593, -592, -592, -592, -592, -592, -592, -592, -591, -591,
+    -591, -591, -591, -591, -591, -590, -590, -590, -590, -590, -590, -590, -589, -589, -589, -589,
+    -589, -589, -589, -588, -588, -588, -588, -588, -588, -588, -588, -587, -587, -587, -587, -587,
+    -587, -587, 2286, 2285, 2285, 2284, 2283, 2283, 2282, 2282, 2281, 2281, 2280, 2280, 2279, 2279,
+    2278, 2278, 2277, 2276, 2276, 2275, 2275, 2274, 2274, 2273, 2273, 2272, 2272, 2271, 2270, 2270,
+    2269, 2269, 2268, 2268, 2267, 2267, 2266, 2266, 2265, 2265, 2264, 2263, 2263, 2262, 2262, 2261,
+    2261, 2260, 2260, 2259, 2259, 2258, 2258, 2257, 2256, 2256, 2255, 2255, 2254, 2254, -2752, -2751,
+    -2751, -2750, -2749, -2749, -2748, -2747, -2747, -2746, -2745, -2745, -2744, -2743, -2743, -2742, -2741, -2741,
+    -2740, -2739, -2739, -2738, -2737, -2737, -2736, -2735, -2735, -2734, -2733, -2733, -2732, -2731, -2731, -2730,
+    -2729, -2729, -2728, -2727, -2727, -2726, -2726, -2725, -2724, -2724, -2723, -2722, -2722, -2721, -2720, -2720,
+    -2719, -2718, -2718, -2717, -2716, -2716, -2715, -2714, -2714, -2713, 1158, 1158, 1158, 1157, 1157, 1157,
+    1157, 1156, 1156, 1156, 1155, 1155, 1155, 1155, 1154, 1154, 1154, 1154, 1153, 1153, 1153, 1152,
+    1152, 1152, 1152, 1151, 1151, 1151, 1150, 1150, 1150, 1150, 1149, 1149, 1149, 1148, 1148, 1148,
+    1148, 1147, 1147, 1147, 1146, 1146, 1146, 1146, 1145, 1145, 1145, 1144, 1144, 1144, 1144, 1143,
+    982, 982, 981, 981, 981, 981, 980, 980, 980, 980, 979, 979, 979, 979, 978, 978,
+    978, 978, 977, 977, 977, 977, 977, 976, 976, 976, 976, 975, 975, 975, 975, 974,
+    974, 974, 974, 973, 973, 973, 973, 972, 972, 972, 972, 971, 971, 971, 971, 970,
+    970, 970, 970, 969, 969, 969, -3069, -3068, -3067, -3067, -3066, -3065, -3064, -3063, -3063, -3062,
+    -3061, -3060, -3060, -3059, -3058, -3057, -3057, -3056, -3055, -3054, -3053, -3053, -3052, -3051, -3050, -3050,
+    -3049, -3048, -3047, -3047, -3046, -3045, -3044, -3044, -3043, -3042, -3041, -3040, -3040, -3039, -3038, -3037,
+    -3037, -3036, -3035, -3034, -3034, -3033, -3032, -3031, -3030, -3030, -3029, -3028, -3027, -3027, -3026, -3025,
+    2461, 2461, 2460, 2460, 2459, 2458, 2458, 2457, 2456, 2456, 2455, 2455, 2454, 2453, 2453, 2452,
+    2451, 2451, 2450, 2450, 2449, 2448, 2448, 2447, 2446, 2446, 2445, 2445, 2444, 2443, 2443, 2442,
+    2441, 2441, 2440, 2440, 2439, 2438, 2438, 2437, 2436, 2436, 2435, 2435, 2434, 2433, 2433, 2432,
+    2431, 2431, 2023, 2022, 2022, 2021, 2021, -830, -830, -829, -829, -829, -829, -828, -828, -828,
+    -828, -828, -827, -827, -827, -827, -827, -826, -826, -826, -826, -825, -825, -825, -825, -825,
+    -824, -824, -824, -824, -824, -823, -823, -823, -823, -822, -822, -822, -822, -822, -821, -821,
+    -821, -821, -821, -820, -820, -820, -820, -820, -819, 1085, 1084, 1084, 1084, 1084, 1083, 1083,
+    1083, 1082, 1082, 1082, 1082, 1081, 1081, 1081, 1081, 1080, 1080, 1080, 1079, 1079, 1079, 1079,
+    1078, 1078, 1078, 1077, 1077, 1077, 1077, 1076, 1076, 1076, 1075, 1075, 1075, 1075, 1074, 1074,
+    1074, 1073, 1073, 1073, 1073, 1072, 1072, 1072, 1071, 1071, 1071, 1071, 1070, 1070, 1070, 1069,
+    -468, -468, -468, -468, -468, -468, -468, -467, -467, -467, -467, -467, -467, -467, -467, -466,
+    -466, -466, -466, -466, -466, -466, -466, -465, -465, -465, -465, -465, -465, -465, -465, -464,
+    -464, -464, -464, -464, -464, -464, -464, -463, -463, -463, -463, -463, -463, -463, -463, -462,
+    -462, -462, 2029, 2029, 2028, 2028, 2027, 2027, 2026, 2025, 2025, 2024, 2024, 2023, 2023, 2022,
+    2022, 2021, 2021, 2020, 2020, 2019, 2018, 2018, 2017, 2017, 2016, 2016, 2015, 2015, 2014, 2014,
+    2013, 2012, 2012, 2011, 2011, 2010, 2010, 2009, 2009, 2008, 2008, 2007, 2006, 2006, 2005, 2005,
+    2004, 2004, 2003, 2003, -225, -225, -225, -225, -225, -1560, -1559, -1559, -1558, -1558, -1557, -1557,
+    -1557, -1556, -1556, -1555, -1555, -1554, -1554, -1554, -1553, -1553, -1552, -1552, -1551, -1551, -1551, -1550,
+    -1550, -1549, -1549, -1548, -1548, -1548, -1547, -1547, -1546, -1546, -1546, -1545, -1545, -1544, -1544, -1543,
+    -1543, -1543, -1542, -1542, -1541, -1541, -1540, -1540, -1540, -1539, -1539, -850, -850, -849, -849, -849,
+    -849, -848, -848, -848, -848, -847, -847, -847, -847, -847, -846, -846, -846, -846, -845, -845,
+    -845, -845, -844, -844, -844, -844, -843, -843, -843, -843, -843, -842, -842, -842, -842, -841,
+    -841, -841, -841, -840, -840, -840, -840, -839, -839, -839, -839, -839, -1400, -1399, -1399, -1399,
+    -1398, -1398, -1398, -1397, -1397, -1396, -1396, -1396, -1395, -1395, -1394, -1394, -1394, -1393, -1393, -1392,
+    -1392, -1392, -1391, -1391, -1391, -1390, -1390, -1389, -1389, -1389, -1388, -1388, -1387, -1387, -1387, -1386,
+    -1386, -1385, -1385, -1385, -1384, -1384, -1383, -1383, -1383, -1382, -1382, -1382, -1179, -1179, -1179, -1178,
+    -1178, -1178, -1177, -1177, -1177, -1176, -1176, -1176, -1175, -1175, -1175, -1174, -1174, -1174, -1173, -1173,
+    -1173, -1172, -1172, -1172, -1171, -1171, -1171, -1170, -1170, -1170, -1169, -1169, -1169, -1168, -1168, -1168,
+    -1167, -1167, -1167, -1166, -1166, -1166, -1165, -1165, -1165, -1164, -1164, -1164, 127, 127, 127, 127,
+    127, 127, 127, 127, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 2327, 2326, 2325, 2325,
+    2324, 2323, 2323, 2322, 2321, 2321, 2320, 2319, 2319, 2318, 2317, 2317, 2316, 2315, 2314, 2314,
+    2313, 2312, 2312, 2311, 2310, 2310, 2309, 2308, 2308, 2307, 2306, 2306, 2305, 2304, 2304, 2303,
+    2302, 2302, 2301, 2300, 2300, 2299, 2298, 2298, 2297, 2296, 2296, 2295, 1383, 1382, 1382, 1381,
+    1381, 1381, 1380, 1380, 1379, 1379, 1379, 1378, 1378, 1377, 1377, 1377, 1376, 1376, 1375, 1375,
+    1375, 1374, 1374, 1373, 1373, 1373, 1372, 1372, 1371, 1371, 1370, 1370, 1370, 1369, 1369, 1368,
+    1368, 1368, 1367, 1367, 1366, 1366, 1366, 1365, 1365, 1364, 1364, 1364, 2015, 2015, 2014, 2013,
+    2013, 2012, 2012, 2011, 2010, 2010, 2009, 2009, 2008, 2007, 2007, 2006, 2005, 2005, 2004, 2004,
+    2003, 2002, 2002, 2001, 2001, 2000, 1999, 1999, 1998, 1998, 1997, 1996, 1996, 1995, 1995, 1994,
+    1993, 1993, 1992, 1992, 1991, 1990, 1990, 1989, 1211, 1210, 1210, 1210, -1121, -1121, -1120, -1120,
+    -1120, -1119, -1119, -1119, -1118, -1118, -1118, -1117, -1117, -1117, -1116, -1116, -1116, -1115, -1115, -1115,
+    -1114, -1114, -1114, -1113, -1113, -1112, -1112, -1112, -1111, -1111, -1111, -1110, -1110, -1110, -1109, -1109,
+    -1109, -1108, -1108, -1108, -1107, -1107, -1107, -1106, 1589, 1589, 1588, 1588, 1587, 1587, 1586, 1586,
+    1585, 1585, 1584, 1584, 1583, 1583, 1582, 1582, 1581, 1581, 1580, 1580, 1579, 1579, 1578, 1578,
+    1577, 1577, 1576, 1576, 1575, 1575, 1574, 1574, 1573, 1573, 1572, 1572, 1571, 1571, 1570, 1570,
+    1570, 1569, 1569, 1568, 1424, 1423, 1423, 1423, 1402, 1401, 1401, 1400, 1400, 1399, 1399, 1399,
+    1398, 1398, 1397, 1397, 1396, 1396, 1395, 1395, 1395, 1394, 1394, 1393, 1393, 1392, 1392, 1392,
+    1391, 1391, 1390, 1390, 1389, 1389, 1388, 1388, 1388, 1387, 1387, 1386, 1386, 1385, 1385, 1385,
+    1384, 1384, 1383, 187, 187, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+    185, 185, 185, 185, 185, 185, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+    184, 184, 184, 184, 184, 184, 184, 183, 183, -1668, -1668, -1667, -1666, -1666, -1665, -1665,
+    -1664, -1664, -1663, -1663, -1662, -1662, -1661, -1661, -1660, -1659, -1659, -1658, -1658, -1657, -1657, -1656,
+    -1656, -1655, -1655, -1654, -1654, -1653, -1653, -1652, -1651, -1651, -1650, -1650, -1649, -1649, -1648, -1648,
+    -1647, -1647, -1646, -1646, -1645, -1644, -1644, -1643, -1643, -1642, -1642, -1641, -1641, -1640, -1640, -1718,
+    -1718, -1717, -1717, -1716, -1716, -1715, -1715, -1714, -1713, -1713, -1712, -1712, -1711, -1711, -1710, -1709,
+    -1709, -1708, -1708, -1707, -1707, -1706, -1706, -1705, -1704, -1704, -1703, -1703, -1702, -1702, -1701, -1700,
+    -1700, -1699, -1699, -1698, -1698, -1697, -1696, -1696, -1695, -1695, -1694, -1694, -1693, -1693, -1692, -1691,
+    -1691, -1690, -1690, -1689, -1689, -2081, -2080, -2080, -2079, -2078, -2078, -2077, -2076, -2075, -2075, -2074,
+    -2073, -2073, -2072, -2071, -2071, -2070, -2069, -2068, -2068, -2067, -2066, -2066, -2065, -2064, -2064, -2063,
+    -2062, -2062, -2061, -2060, -2059, -2059, -2058, -2057, -2057, -2056, -2055, -2055, -2054, -2053, -2053, -2052,
+    -2051, -2050, -2050, -2049, -2048, -2048, -2047, -2046, -2046, -2045, -2044, -1027, -1027, -1026, -1026, -1026,
+    -1025, -1025, -1025, -1024, -1024, -1024, -1023, -1023, -1022, -1022, -1022, -1021, -1021, -1021, -1020, -1020,
+    -1020, -1019, -1019, -1019, -1018, -1018, -1018, -1017, -1017, -1017, -1016, -1016, -1016, -1015, -1015, -1014,
+    -1014, -1014, -1013, -1013, -1013, -1012, -1012, -1012, -1011, -1011, -1011, -1010, -1010, -1010, -1389, -1389,
+    -1388, -1388, -1388, -1387, -1387, -1386, -1386, -1385, -1385, -1384, -1384, -1383, -1383, -1382, -1382, -1381,
+    -1381, -1380, -1380, -1379, -1379, -1378, -1378, -1377, -1377, -1376, -1376, -1376, -1375, -1375, -1374, -1374,
+    -1373, -1373, -1372, -1372, -1371, -1371, -1370, -1370, -1369, -1369, -1368, -1368, -1367, -1367, -1366, -1366,
+    -1365, 399, 399, 398, 398, 398, 398, 398, 398, 398, 398, 397, 397, 397, 397, 397,
+    397, 397, 396, 396, 396, 396, 396, 396, 396, 395, 395, 395, 395, 395, 395, 395,
+    394, 394, 394, 394, 394, 394, 394, 393, 393, 393, 393, 393, 393, 393, 392, 392,
+    392, 392, 392, 392, 530, 530, 530, 530, 529, 529, 529, 529, 529, 528, 528, 528,
+    528, 528, 527, 527, 527, 527, 527, 526, 526, 526, 526, 526, 526, 525, 525, 525,
+    525, 525, 524, 524, 524, 524, 524, 523, 523, 523, 523, 523, 522, 522, 522, 522,
+    522, 522, 521, 521, 521, 521, 521, -1744, -1743, -1743, -1742, -1741, -1741, -1740, -1739, -1739,
+    -1738, -1737, -1737, -1736, -1736, -1735, -1734, -1734, -1733, -1732, -1732, -1731, -1730, -1730, -1729, -1729,
+    -1728, -1727, -1727, -1726, -1725, -1725, -1724, -1723, -1723, -1722, -1722, -1721, -1720, -1720, -1719, -1718,
+    -1718, -1717, -1716, -1716, -1715, -1715, -1714, -1133, -1132, -1132, -1132, -1131, -1131, -1130, -1130, -1130,
+    -1129, -1129, -1128, -1128, -1127, -1127, -1127, -1126, -1126, -1125, -1125, -1124, -1124, -1124, -1123, -1123,
+    -1122, -1122, -1122, -1121, -1121, -1120, -1120, -1119, -1119, -1119, -1118, -1118, -1117, -1117, -1116, -1116,
+    -1116, -1115, -1115, -1114, -1114, -1114, -1113, -1113, 1125, 1124, 1124, 1123, 1123, 1123, 1122, 1122,
+    1121, 1121, 1120, 1120, 1120, 1119, 1119, 1118, 1118, 1117, 1117, 1117, 1116, 1116, 1115, 1115,
+    1114, 1114, 1114, 1113, 1113, 1112, 1112, 1111, 1111, 1111, 1110, 1110, 1109, 1109, 1109, 1108,
+    1108, 1107, 1107, 1106, 1106, 1106, 1105, 1105, -125, -125, -125, -125, -125, -125, -124, -124,
+    -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124, -124,
+    -124, -124, -124, -123, -123, -123, -123, -123, -123, -123, -123, -123, -123, -123, -123, -123,
+    -123, -123, -123, -123, -123, -123, -123, -123, -460, -460, -460, -460, -460, -460, -459, -459,
+    -459, -459, -459, -459, -458, -458, -458, -458, -458, -457, -457, -457, -457, -457, -457, -456,
+    -456, -456, -456, -456, -455, -455, -455, -455, -455, -455, -454, -454, -454, -454, -454, -453,
+    -453, -453, -453, -453, -453, -452, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, -35, -35, -49, -49, -49, -49, -49, -49, -49, -49, -49, -49,
+    -49, -49, -49, -49, -49, -49, -49, -49, -49, -49, -49, -48, -48, -48, -48, -48,
+    -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48, -48,
+    -48, -48, 1020, 1019, 1019, 1019, 1018, 1018, 1017, 1017, 1016, 1016, 1016, 1015, 1015, 1014,
+    1014, 1013, 1013, 1013, 1012, 1012, 1011, 1011, 1010, 1010, 1010, 1009, 1009, 1008, 1008, 1007,
+    1007, 1007, 1006, 1006, 1005, 1005, 1005, 1004, 1004, 1003, 1003, 1002, 1002, 1002, 1001, 1001,
+    -924, -923, -923, -923, -922, -922, -921, -921, -921, -920, -920, -919, -919, -919, -918, -918,
+    -918, -917, -917, -916, -916, -916, -915, -915, -914, -914, -914, -913, -913, -912, -912, -912,
+    -911, -911, -910, -910, -910, -909, -909, -909, -908, -908, -907, -907, 1648, 1647, 1647, 1646,
+    1645, 1644, 1644, 1643, 1642, 1642, 1641, 1640, 1639, 1639, 1638, 1637, 1637, 1636, 1635, 1634,
+    1634, 1633, 1632, 1632, 1631, 1630, 1630, 1629, 1628, 1627, 1627, 1626, 1625, 1625, 1624, 1623,
+    1622, 1622, 1621, 1620, 1620, 1619, 1618, 1617, -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -126, -126, -126, -126, -126, -126, -126, -126, -126, -126,
+    -126, -126, -126, -126, -126, -126, -126, -126, -125, -125, -125, -125, -125, -125, -125, -125,
+    -125, -125, -125, -125, 1697, 1697, 1696, 1695, 1694, 1694, 1693, 1692, 1691, 1690, 1690, 1689,
+    1688, 1687, 1687, 1686, 1685, 1684, 1684, 1683, 1682, 1681, 1681, 1680, 1679, 1678, 1678, 1677,
+    1676, 1675, 1674, 1674, 1673, 1672, 1671, 1671, 1670, 1669, 1668, 1668, 1667, 1666, 1391, 1390,
+    568, 567, 567, 567, 567, 566, 566, 566, 566, 565, 565, 565, 565, 564, 564, 564,
+    564, 563, 563, 563, 562, 562, 562, 562, 561, 561, 561, 561, 560, 560, 560, 560,
+    559, 559, 559, 559, 558, 558, 558, 558, 557, 557, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, -1036, -1035, -1035, -1034, -1034, -1033, -1033, -1032, -1032, -1031, -1031, -1030,
+    -1030, -1029, -1029, -1028, -1028, -1027, -1027, -1026, -1026, -1025, -1025, -1025, -1024, -1024, -1023, -1023,
+    -1022, -1022, -1021, -1021, -1020, -1020, -1019, -1019, -1018, -1018, -1017, -1017, -1016, -1016, 1501, 1500,
+    1500, 1499, 1498, 1497, 1497, 1496, 1495, 1495, 1494, 1493, 1492, 1492, 1491, 1490, 1489, 1489,
+    1488, 1487, 1487, 1486, 1485, 1484, 1484, 1483, 1482, 1481, 1481, 1480, 1479, 1478, 1478, 1477,
+    1476, 1476, 1475, 1474, 1473, 1473, 1385, 1384, 1124, 1123, 1122, 1122, 1121, 1121, 1120, 1120,
+    1119, 1119, 1118, 1117, 1117, 1116, 1116, 1115, 1115, 1114, 1114, 1113, 1112, 1112, 1111, 1111,
+    1110, 1110, 1109, 1109, 1108, 1107, 1107, 1106, 1106, 1105, 1105, 1104, 1104, 1103, 1102, 1102,
+    1215, 1214, 1214, 1213, 1212, 1212, 1211, 1210, 1210, 1209, 1209, 1208, 1207, 1207, 1206, 1206,
+    1205, 1204, 1204, 1203, 1202, 1202, 1201, 1201, 1200, 1199, 1199, 1198, 1198, 1197, 1196, 1196,
+    1195, 1194, 1194, 1193, 1193, 1192, 1191, 1191, 683, 683, 683, 682, 682, 682, 681, 681,
+    681, 680, 680, 680, 679, 679, 678, 678, 678, 677, 677, 677, 676, 676, 676, 675,
+    675, 675, 674, 674, 674, 673, 673, 672, 672, 672, 671, 671, 671, 670, 670, 670,
+    -341, -341, -341, -340, -340, -340, -340, -340, -340, -339, -339, -339, -339, -339, -338, -338,
+    -338, -338, -338, -338, -337, -337, -337, -337, -337, -336, -336, -336, -336, -336, -336, -335,
+    -335, -335, -335, -335, -334, -334, -334, -334, 768, 768, 767, 767, 767, 766, 766, 765,
+    765, 765, 764, 764, 763, 763, 763, 762, 762, 761, 761, 760, 760, 760, 759, 759,
+    758, 758, 758, 757, 757, 756, 756, 755, 755, 755, 754, 754, 753, 753, 753, 752,
+    1073, 1073, 1072, 1072, 1071, 1070, 1070, 1069, 1069, 1068, 1067, 1067, 1066, 1066, 1065, 1064,
+    1064, 1063, 1063, 1062, 1062, 1061, 1060, 1060, 1059, 1059, 1058, 1057, 1057, 1056, 1056, 1055,
+    1054, 1054, 1053, 1053, 1052, 1051, 1372, 1371, 1370, 1369, 1369, 1368, 1367, 1366, 1366, 1365,
+    1364, 1363, 1363, 1362, 1361, 1360, 1359, 1359, 1358, 1357, 1356, 1356, 1355, 1354, 1353, 1352,
+    1352, 1351, 1350, 1349, 1349, 1348, 1347, 1346, 1346, 1345, 1344, 1343, 860, 860, 791, 790,
+    790, 789, 789, 788, 788, 787, 787, 786, 786, 786, 785, 785, 784, 784, 783, 783,
+    782, 782, 781, 781, 781, 780, 780, 779, 779, 778, 778, 777, 777, 776, 776, 776,
+    775, 775, 583, 582, 555, 554, 554, 554, 553, 553, 553, 552, 552, 552, 551, 551,
+    551, 550, 550, 550, 549, 549, 549, 548, 548, 548, 547, 547, 547, 546, 546, 546,
+    545, 545, 545, 544, 544, 544, 543, 543, 543, 542, 542, 542, 541, 541, 541, 541,
+    137, 137, 137, 137, 137, 137, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+    136, 136, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 134, 134,
+    134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 133, 133, -658, -658, -771, -770,
+    -770, -769, -769, -768, -768, -767, -767, -766, -766, -765, -765, -764, -764, -763, -763, -762,
+    -762, -762, -761, -761, -760, -760, -759, -759, -758, -758, -757, -757, -756, -756, -755, -755,
+    -754, -754, -753, -753, -752, -752, -751, -751, -386, -386, -264, -264, -264, -264, -264, -264,
+    -263, -263, -263, -263, -263, -262, -262, -262, -262, -262, -262, -261, -261, -261, -261, -261,
+    -261, -260, -260, -260, -260, -260, -260, -259, -259, -259, -259, -259, -259, -258, -258, -258,
+    -258, -258, -258, -257, -632, -632, -632, -631, -631, -630, -630, -629, -629, -629, -628, -628,
+    -627, -627, -627, -626, -626, -625, -625, -624, -624, -624, -623, -623, -622, -622, -622, -621,
+    -621, -620, -620, -619, -619, -619, -618, -618, -617, -617, -617, -616, -616, -615, -615, -615,
+    423, 422, 422, 422, 422, 421, 421, 421, 420, 420, 420, 420, 419, 419, 419, 418,
+    418, 418, 418, 417, 417, 417, 416, 416, 416, 416, 415, 415, 415, 414, 414, 414,
+    414, 413, 413, 413, 412, 412, 412, 412, 411, 411, -545, -545, -544, -544, -544, -543,
+    -543, -542, -542, -542, -541, -541, -541, -540, -540, -539, -539, -539, -538, -538, -537, -537,
+    -537, -536, -536, -536, -535, -535, -534, -534, -534, -533, -533, -533, -532, -532, -531, -531,
+    -531, -530, -530, -530, 958, 957, 956, 956, 955, 954, 954, 953, 952, 952, 951, 950,
+    950, 949, 948, 948, 947, 946, 946, 945, 944, 943, 943, 942, 941, 941, 940, 939,
+    939, 938, 937, 937, 936, 935, 935, 934, 933, 932, 932, 931, 930, 930, 488, 488,
+    487, 487, 486, 486, 486, 485, 485, 485, 484, 484, 484, 483, 483, 483, 482, 482,
+    481, 481, 481, 480, 480, 480, 479, 479, 479, 478, 478, 477, 477, 477, 476, 476,
+    476, 475, 475, 475, 474, 474, 483, 483, 499, 498, 498, 498, 497, 497, 496, 496,
+    496, 495, 495, 494, 494, 494, 493, 493, 493, 492, 492, 491, 491, 491, 490, 490,
+    490, 489, 489, 488, 488, 488, 487, 487, 486, 486, 486, 485, 485, 485, 484, 484,
+    495, 494, 494, 493, 493, 493, 492, 492, 492, 491, 491, 490, 490, 490, 489, 489,
+    488, 488, 488, 487, 487, 486, 486, 486, 485, 485, 485, 484, 484, 483, 483, 483,
+    482, 482, 481, 481, 481, 480, 480, 479, 563, 562, 562, 562, 561, 561, 560, 560,
+    559, 559, 558, 558, 557, 557, 557, 556, 556, 555, 555, 554, 554, 553, 553, 552,
+    552, 552, 551, 551, 550, 550, 549, 549, 548, 548, 547, 547, 546, 546, 546, 545,
+    -422, -422, -422, -421, -421, -420, -420, -420, -419, -419, -419, -418, -418, -418, -417, -417,
+    -417, -416, -416, -416, -415, -415, -414, -414, -414, -413, -413, -413, -412, -412, -412, -411,
+    -411, -411, -410, -410, -410, -409, -409, -408, -84, -84, -84, -84, -84, -84, -84, -84,
+    -83, -83, -83, -83, -83, -83, -83, -83, -83, -83, -83, -83, -83, -83, -82, -82,
+    -82, -82, -82, -82, -82, -82, -82, -82, -82, -82, -82, -82, -81, -81, 100, 99,
+    99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 98, 98, 98, 98, 98, 98,
+    98, 98, 98, 98, 98, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+    96, 96, 96, 96, 329, 329, 717, 716, 716, 715, 714, 714, 713, 712, 712, 711,
+    710, 710, 709, 708, 708, 707, 706, 706, 705, 704, 704, 703, 702, 702, 701, 700,
+    700, 699, 698, 698, 697, 696, 696, 695, 694, 694, 593, 592, -108, -108, -108, -107,
+    -107, -107, -107, -107, -107, -107, -107, -107, -106, -106, -106, -106, -106, -106, -106, -106,
+    -106, -106, -105, -105, -105, -105, -105, -105, -105, -105, -105, -105, -104, -104, -104, -104,
+    2, 2, 320, 320, 320, 319, 319, 319, 318, 318, 318, 318, 317, 317, 317, 316,
+    316, 316, 315, 315, 315, 314, 314, 314, 313, 313, 313, 312, 312, 312, 311, 311,
+    311, 310, 310, 310, 309, 309, -500, -500, -615, -614, -613, -613, -612, -612, -611, -610,
+    -610, -609, -608, -608, -607, -606, -606, -605, -605, -604, -603, -603, -602, -601, -601, -600,
+    -599, -599, -598, -597, -597, -596, -596, -595, -594, -594, -593, -592, -11, -11, -11, -11,
+    -11, -11, -11, -11, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10,
+    -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10,
+    525, 524, 524, 523, 522, 522, 521, 521, 520, 520, 519, 518, 518, 517, 517, 516,
+    515, 515, 514, 514, 513, 512, 512, 511, 511, 510, 509, 509, 508, 508, 507, 507,
+    506, 505, 505, 504, -53, -52, -607, -606, -606, -605, -604, -604, -603, -602, -601, -601,
+    -600, -599, -599, -598, -597, -596, -596, -595, -594, -594, -593, -592, -591, -591, -590, -589,
+    -589, -588, -587, -586, -586, -585, -584, -584, -275, -275, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 143, 143, 159, 159,
+    158, 158, 158, 158, 158, 157, 157, 157, 157, 157, 156, 156, 156, 156, 156, 155,
+    155, 155, 155, 154, 154, 154, 154, 154, 153, 153, 153, 153, 153, 152, 152, 152,
+    -236, -235, -235, -235, -234, -234, -234, -233, -233, -233, -233, -232, -232, -232, -231, -231,
+    -231, -230, -230, -230, -229, -229, -229, -228, -228, -228, -227, -227, -227, -227, -226, -226,
+    -226, -225, -64, -64, 203, 203, 203, 202, 202, 202, 201, 201, 201, 201, 200, 200,
+    200, 199, 199, 199, 199, 198, 198, 198, 197, 197, 197, 197, 196, 196, 196, 195,
+    195, 195, 195, 194, 194, 194, 240, 240, 239, 239, 239, 238, 238, 238, 237, 237,
+    237, 236, 236, 235, 235, 235, 234, 234, 234, 233, 233, 233, 232, 232, 232, 231,
+    231, 230, 230, 230, 229, 229, 229, 228, -34, -34, -34, -34, -34, -33, -33, -33,
+    -33, -33, -33, -33, -33, -33, -33, -33, -33, -33, -33, -33, -33, -33, -33, -33,
+    -33, -32, -32, -32, -32, -32, -32, -32, -32, -32, -422, -421, -420, -420, -419, -418,
+    -417, -417, -416, -415, -415, -414, -413, -413, -412, -411, -411, -410, -409, -408, -408, -407,
+    -406, -406, -405, -404, -404, -403, -402, -401, -401, -400, -399, -399, -282, -281, -281, -280,
+    -280, -279, -279, -278, -278, -278, -277, -277, -276, -276, -275, -275, -274, -274, -273, -273,
+    -272, -272, -271, -271, -270, -270, -269, -269, -268, -268, -267, -267, -266, -266, 350, 349,
+    348, 348, 347, 346, 346, 345, 344, 344, 343, 342, 342, 341, 340, 340, 339, 338,
+    338, 337, 337, 336, 335, 335, 334, 333, 333, 332, 331, 331, 330, 329, 263, 263,
+    67, 67, 67, 67, 66, 66, 66, 66, 66, 66, 66, 65, 65, 65, 65, 65,
+    65, 65, 65, 64, 64, 64, 64, 64, 64, 64, 63, 63, 63, 63, 63, 63,
+    -48, -48, -47, -47, -47, -47, -47, -47, -47, -47, -47, -47, -46, -46, -46, -46,
+    -46, -46, -46, -46, -46, -46, -45, -45, -45, -45, -45, -45, -45, -45, -45, -45,
+    -44, -44, -44, -44, -44, -44, 280, 279, 278, 278, 277, 276, 276, 275, 274, 274,
+    273, 272, 272, 271, 271, 270, 269, 269, 268, 267, 267, 266, 265, 265, 264, 263,
+    263, 262, 262, 261, 260, 260, 259, 258, 258, 257, 256, 256, 151, 151, 151, 150,
+    150, 150, 149, 149, 148, 148, 148, 147, 147, 146, 146, 146, 145, 145, 145, 144,
+    144, 143, 143, 143, 142, 142, 142, 141, 141, 140, 140, 140, 139, 139, 138, 138,
+    138, 137, 219, 218, 217, 217, 216, 216, 215, 214, 214, 213, 213, 212, 211, 211,
+    210, 209, 209, 208, 208, 207, 206, 206, 205, 205, 204, 203, 203, 202, 202, 201,
+    200, 200, 199, 198, 198, 197, -119, -119, -163, -163, -162, -162, -161, -161, -160, -160,
+    -159, -159, -158, -158, -157, -157, -156, -156, -155, -155, -154, -154, -153, -153, -152, -152,
+    -151, -151, -150, -150, -149, -149, -148, -148, -147, -147, -143, -143, -120, -120, -119, -119,
+    -118, -118, -117, -117, -117, -116, -116, -115, -115, -115, -114, -114, -113, -113, -112, -112,
+    -112, -111, -111, -110, -110, -109, -109, -109, -108, -108, -107, -107, -107, -106, -106, -105,
+    -30, -30, -29, -29, -29, -29, -29, -29, -29, -29, -28, -28, -28, -28, -28, -28,
+    -28, -28, -28, -27, -27, -27, -27, -27, -27, -27, -27, -26, -26, -26, -26, -26,
+    -26, -26, -26, -26, -94, -93, -93, -92, -92, -91, -91, -91, -90, -90, -89, -89,
+    -88, -88, -87, -87, -87, -86, -86, -85, -85, -84, -84, -84, -83, -83, -82, -82,
+    -81, -81, -80, -80, -80, -79, -40, -40, 76, 75, 75, 74, 74, 73, 73, 73,
+    72, 72, 71, 71, 70, 70, 70, 69, 69, 68, 68, 67, 67, 67, 66, 66,
+    65, 65, 64, 64, 64, 63, 63, 62, 62, 61, 86, 85, 85, 84, 84, 83,
+    82, 82, 81, 81, 80, 79, 79, 78, 77, 77, 76, 76, 75, 74, 74, 73,
+    73, 72, 71, 71, 70, 70, 69, 68, 68, 67, 67, 66, 65,
+};
+
+const int16_t embeddedShootPcm[5115] = {
+    0, 125, 167, 205, 241, -275, -307, -338, -368, -397, -424, -452, -478, -504, -530, -554,
+    -579, -603, -627, 649, 672, 695, 717, -741, -762, -784, -806, -827, -848, -868, -889, -909,
+    -930, -950, -969, -989, -1009, 1027, 1046, 1065, 1084, -673, -685, -1142, -1160, -1178, -1197, -1215,
+    -1233, -1251, -1268, -1286, -1304, -1321, -1339, 1355, 1372, 1389, 1407, 867, 878, -1458, -1475, -1492,
+    -1508, -1525, -1541, -1558, -1574, -1590, -1606, -1623, -1639, 1346, 1359, 1685, 1701, 1717, 1733, -1749,
+    -1765, -1781, -1796, -1811, -1827, -1842, -1857, -1873, -1888, -1903, -1918, -1178, -1188, 1962, 1977, 1992,
+    2006, -2022, -2037, -2052, -2066, -2081, -2095, -2110, -2124, -2139, -2153, -2168, -2182, -2196, -2210, 2224,
+    2238, 2252, 2266, 1389, 1398, -2309, -2323, -2337, -2351, -2365, -2378, -2392, -2406, -2420, -2433, -2447,
+    -2461, 919, 924, 2500, 2514, 2528, 2541, -2555, -2569, -2582, -2596, -2609, -2622, -2635, -2649, -2662,
+    -2675, -2688, -2701, -2714, -2728, 2740, 2753, 2766, 2779, 1037, 1042, -2818, -2831, -2844, -2857, -2870,
+    -2883, -2895, -2908, -2921, -2934, -2946, -2959, 0, 0, 2996, 3008, 3021, 3034, -3047, -3060, -3072,
+    -3084, -3097, -3109, -3122, -3134, -3146, -3159, -3171, -3183, -3196, -3208, 3219, 3231, 3244, 3256, 3268,
+    3280, -3293, -3305, -3317, -3330, -3342, -3354, -3366, -3378, -3390, -3402, -3414, -3426, -3438, -3449, 3460,
+    3472, 3484, 3496, 2138, 2145, -3532, -3544, -3556, -3568, -3579, -3591, -3603, -3614, -3626, -3638, -3649,
+    -3661, -3673, -3684, 3695, 3706, 3718, 3730, 0, 0, -3765, -3777, -3788, -3799, -3811, -3822, -3834,
+    -3845, -3857, -3868, -3879, -3891, -2378, -2385, 3924, 3935, 3946, 3957, -2420, -2427, -3992, -4003, -4015,
+    -4026, -4037, -4048, -4059, -4070, -4082, -4093, -4104, -4115, -1533, -1537, 4147, 4158, 4169, 4180, -3414,
+    -3423, -4214, -4225, -4236, -4247, -4258, -4269, -4280, -4291, -4302, -4313, -4324, -4334, -1615, -1619, 4366,
+    4377, 4388, 4398, -2688, -2695, -4432, -4442, -4453, -4464, -4475, -4485, -4496, -4507, -4518, -4528, -4539,
+    -4550, -2780, -2786, 4580, 4591, 4602, 4612, -1718, -1722, -4645, -4656, -4666, -4677, -4687, -4698, -4708,
+    -4719, -4729, -4740, -4750, -4761, -4771, -4782, 4791, 4801, 4812, 4822, 3935, 3943, -4854, -4865, -4875,
+    -4886, -4896, -4906, -4917, -4927, -4937, -4947, -4958, -4968, -4978, -4989, 4998, 5008, 5018, 5029, 5039,
+    5049, -5060, -5071, -5081, -5091, -5101, -5111, -5121, -5132, -5142, -5152, -5162, -5172, -5182, -5192, 3170,
+    3176, 5222, 5232, 5242, 5252, -4285, -4294, -5283, -5293, -5303, -5313, -5323, -5333, -5343, -5353, -5363,
+    -5373, -5383, -5393, -5403, -5413, 5422, 5432, 5442, 5451, 4447, 4455, -5482, -5492, -5502, -5512, -5522,
+    -5532, -5541, -5551, -5561, -5571, -5581, -5591, -5600, -5610, 5619, 5629, 5638, 5648, 5658, 5668, -5679,
+    -5688, -5698, -5708, -5717, -5727, -5737, -5747, -5756, -5766, -5776, -5785, -5795, -5805, -5814, -5824, 5833,
+    5842, 5852, 5862, 5871, 5881, -5891, -5901, -5911, -5920, -5930, -5939, -5949, -5959, -5968, -5978, -5987,
+    -5997, -6006, -6016, 3672, 3677, 6043, 6053, 6062, 6072, -3707, -3713, -6101, -6111, -6120, -6130, -6139,
+    -6149, -6158, -6167, -6177, -6186, -6196, -6205, -6215, -6224, 6232, 6242, 6251, 6261, 6270, 6279, -6290,
+    -6299, -6308, -6318, -6327, -6336, -6346, -6355, -6364, -6374, -6383, -6392, -6402, -6411, -6420, -6429, 6438,
+    6447, 6456, 6465, 6475, 6484, -6494, -6503, -6513, -6522, -6531, -6540, -6550, -6559, -6568, -6577, -6586,
+    -6596, -6605, -6614, -6623, -6632, 6640, 6650, 6659, 6668, 6677, 6686, -6696, -6705, -6714, -6724, -6733,
+    -6742, -6751, -6760, -6769, -6778, -6787, -6796, -6805, -6814, -5556, -5564, 6841, 6850, 6859, 6868, 6877,
+    6886, -6896, -6905, -6914, -6923, -6932, -6941, -6950, -6959, -6968, -6977, -6986, -6995, -7004, -7013, -7022,
+    -7031, 7039, 7048, 7056, 7065, 7074, 7083, -7093, -7102, -7111, -7120, -7129, -7138, -7147, -7155, -7164,
+    -7173, -7182, -7191, -7200, -7209, -7218, -7226, 7234, 7243, 7252, 7261, 7270, 7278, -7288, -7297, -7306,
+    -7315, -7324, -7332, -7341, -7350, -7359, -7368, -7376, -7385, -7394, -7403, -7411, -7420, 7428, 7437, 7445,
+    7454, 7463, 7472, -4560, -4565, -7499, -7508, -7516, -7525, -7534, -7542, -7551, -7560, -7569, -7577, -7586,
+    -7595, -7603, -7612, 2830, 2834, 7637, 7646, 7654, 7663, 7672, 7680, -7690, -7698, -7707, -7716, -7724,
+    -7733, -7742, -7750, -7759, -7767, -7776, -7785, -7793, -7802, -7810, -7819, 7826, 7835, 7844, 7852, 7861,
+    7869, -7879, -7887, -7896, -7905, -7913, -7922, -7930, -7939, -7947, -7956, -7964, -7973, -7981, -7990, -7998,
+    -8007, 4885, 4890, 8031, 8040, 8048, 8057, 8065, 8074, -8083, -8092, -8100, -8108, -8117, -8125, -8134,
+    -8142, -8151, -8159, -8168, -8176, -8184, -8193, -8201, -8210, 8217, 8225, 8234, 8242, 8251, 8259, -5040,
+    -5045, -8285, -8294, -8302, -8310, -8319, -8327, -8335, -8344, -8352, -8361, -8369, -8377, -8386, -8394, -6842,
+    -6848, 8418, 8426, 8435, 8443, 8451, 8460, -8469, -8477, -8485, -8494, -8502, -8510, -8519, -8527, -8535,
+    -8543, -8552, -8560, -8568, -8577, -8585, -8593, 0, 0, 8617, 8625, 8633, 8642, 8650, 8658, -8667,
+    -8676, -8684, -8692, -8700, -8708, -8717, -8725, -8733, -8741, -8749, -8758, -8766, -8774, -8782, -8790, 3268,
+    3271, 8814, 8822, 8830, 8838, 8847, 8855, -8864, -8872, -8880, -8888, -8897, -8905, -8913, -8921, -8929,
+    -8937, -8945, -8954, -8962, -8970, -8978, -8986, 3341, 3344, 9009, 9017, 9026, 9034, 9042, 9050, -9059,
+    -9067, -9075, -9083, -9091, -9099, -9107, -9115, -9124, -9132, -9140, -9148, -9156, -9164, -9172, -9180, -3414,
+    -3417, 9203, 9211, 9219, 9227, 9235, 9243, -9252, -9260, -9268, -9276, -9284, -9292, -9300, -9308, -9316,
+    -9324, -9332, -9340, -9348, -9356, -9364, -9372, -9380, -9388, 9395, 9403, 9411, 9419, 9427, 9435, -3509,
+    -3512, -9460, -9468, -9476, -9484, -9492, -9500, -9507, -9515, -9523, -9531, -9539, -9547, -9555, -9563, -9571,
+    -9579, 9586, 9594, 9601, 9609, 9617, 9625, 9633, 9641, -9650, -9658, -9666, -9673, -9681, -9689, -9697,
+    -9705, -9713, -9721, -9729, -9736, -9744, -9752, -9760, -9768, -3632, -3635, 9790, 9798, 9806, 9814, 9822,
+    9830, -9838, -9846, -9854, -9862, -9870, -9877, -9885, -9893, -9901, -9909, -9916, -9924, -9932, -9940, -9948,
+    -9955, -9963, -9971, 9978, 9986, 9993, 10001, 10009, 10017, 10024, 10032, -10041, -10049, -10057, -10064, -10072,
+    -10080, -10088, -10095, -10103, -10111, -10118, -10126, -10134, -10142, -10149, -10157, -10165, -10173, 10179, 10187, 10195,
+    10202, 10210, 10218, 6232, 6237, -10242, -10250, -10257, -10265, -10273, -10280, -10288, -10296, -10304, -10311, -10319,
+    -10327, -10334, -10342, -10350, -10357, -6318, -6322, 10379, 10387, 10395, 10402, 10410, 10417, -3874, -3876, -10441,
+    -10449, -10457, -10464, -10472, -10480, -10487, -10495, -10502, -10510, -10518, -10525, -10533, -10541, -10548, -10556, -3925,
+    -3927, 10578, 10585, 10593, 10600, 10608, 10616, -3947, -3950, -10639, -10647, -10655, -10662, -10670, -10677, -10685,
+    -10692, -10700, -10708, -10715, -10723, -10730, -10738, -10745, -10753, -3998, -4001, 10775, 10782, 10790, 10797, 10805,
+    10812, 0, 0, -10836, -10843, -10851, -10858, -10866, -10873, -10881, -10888, -10896, -10903, -10911, -10918, -10926,
+    -10934, -10941, -10949, -8921, -8927, 10970, 10977, 10985, 10992, 11000, 11007, 8969, 8975, -11031, -11038, -11046,
+    -11053, -11061, -11068, -11076, -11083, -11091, -11098, -11106, -11113, -11120, -11128, -11135, -11143, -11150, -11158, 11164,
+    11172, 11179, 11186, 11194, 11201, 11209, 11216, -11225, -11232, -11239, -11247, -11254, -11262, -11269, -11276, -11284,
+    -11291, -11299, -11306, -11313, -11321, -11328, -11336, -11343, -11350, 6922, 6926, 11372, 11379, 11386, 11394, 11401,
+    11409, -4242, -4244, -11432, -11439, -11446, -11454, -11461, -11468, -11476, -11483, -11491, -11498, -11505, -11513, -11520,
+    -11527, -11535, -11542, -11549, -11557, 11563, 11570, 11578, 11585, 11592, 11600, 11607, 11614, -11623, -11630, -11637,
+    -11645, -11652, -11659, -11666, -11674, -11681, -11688, -11696, -11703, -11710, -11718, -11725, -11732, -11739, -11747, -7164,
+    -7169, 11768, 11775, 11782, 11789, 11797, 11804, 11811, 11819, -11827, -11834, -11841, -11849, -11856, -11863, -11870,
+    -11878, -11885, -11892, -11899, -11907, -11914, -11921, -11928, -11936, -11943, -11950, 4441, 4444, 11971, 11978, 11985,
+    11993, 12000, 12007, 9783, 9788, -12030, -12037, -12044, -12051, -12059, -12066, -12073, -12080, -12087, -12095, -12102,
+    -12109, -12116, -12123, -12131, -12138, -12145, -12152, 7410, 7415, 12173, 15638, 15638, 15638, 15637, 15637, 12733,
+    12733, -15638, -15638, -15638, -15638, -15638, -15638, -15638, -15638, -15638, -15638, -15638, -15638, -15638, -15637, -15637,
+    -15637, -15637, -15637, 5808, 5808, 15636, 15636, 15636, 15636, 15636, 15636, 15636, 15636, -15637, -15637, -15636,
+    -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -15636, -12731,
+    -12731, 15634, 15634, 15634, 15634, 15634, 15634, 15634, 15634, -15635, -15635, -15635, -15635, -15635, -15635, -15635,
+    -15635, -15634, -15634, -15634, -15634, -15634, -15634, -15634, -15634, -15634, -15634, -15634, -15634, 15633, 15633, 15633,
+    15633, 15633, 15632, 15632, 15632, 0, 0, -15633, -15633, -15633, -15633, -15633, -15633, -15633, -15633, -15633,
+    -15633, -15633, -15633, -15632, -15632, -15632, -15632, -15632, -15632, -9528, -9528, 15631, 15631, 15631, 15631, 15631,
+    15631, 15631, 15631, -15632, -15631, -15631, -15631, -15631, -15631, -15631, -15631, -15631, -15631, -15631, -15631, -15631,
+    -15631, -15631, -15631, -15631, -15631, -15630, -15630, 12726, 12726, 15629, 15629, 15629, 15629, 15629, 15629, 15629,
+    15629, -15630, -15630, -15630, -15630, -15630, -15629, -15629, -15629, -15629, -15629, -15629, -15629, -15629, -15629, -15629,
+    -15629, -15629, -15629, -15629, -15629, 15628, 15628, 15627, 15627, 15627, 15627, 15627, 15627, 15627, 15627, -15628,
+    -15628, -15628, -15628, -15628, -15628, -15628, -15628, -15628, -15627, -15627, -15627, -15627, -15627, -15627, -15627, -15627,
+    -15627, -15627, -15627, 15626, 15626, 15626, 15626, 15626, 15626, 15625, 15625, 15625, 15625, -15626, -15626, -15626,
+    -15626, -15626, -15626, -15626, -15626, -15626, -15626, -15626, -15626, -15626, -15625, -15625, -15625, -15625, -15625, -15625,
+    -15625, 9523, 9523, 15624, 15624, 15624, 15624, 15624, 15624, 15624, 15624, -15624, -15624, -15624, -15624, -15624,
+    -15624, -15624, -15624, -15624, -15624, -15624, -15624, -15624, -15624, -15624, -15624, -15624, -15623, -15623, -15623, -12721,
+    -12721, 15622, 15622, 15622, 15622, 15622, 15622, 15622, 15622, 0, 0, -15623, -15623, -15622, -15622, -15622,
+    -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15622, -15621, 15620,
+    15620, 15620, 15620, 15620, 15620, 15620, 15620, 15620, 15620, -15621, -15621, -15621, -15621, -15621, -15621, -15620,
+    -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, -15620, 15619,
+    15618, 15618, 15618, 15618, 15618, 15618, 15618, 15618, 15618, -15619, -15619, -15619, -15619, -15619, -15619, -15619,
+    -15619, -15618, -15618, -15618, -15618, -15618, -15618, -15618, -15618, -15618, -15618, -15618, -15618, -15618, -15618, 15617,
+    15617, 15617, 15616, 15616, 15616, 15616, 15616, 15616, 15616, -15617, -15617, -15617, -15617, -15617, -15617, -15617,
+    -15617, -15617, -15617, -15616, -15616, -15616, -15616, -15616, -15616, -15616, -15616, -15616, -15616, -15616, -15616, 15615,
+    15615, 15615, 15615, 15615, 15614, 15614, 15614, 15614, 15614, -15615, -15615, -15615, -15615, -15615, -15615, -15615,
+    -15615, -15615, -15615, -15615, -15615, -15614, -15614, -15614, -15614, -15614, -15614, -15614, -15614, -15614, -15614, 15613,
+    15613, 15613, 15613, 15613, 15613, 15613, 15612, 15612, 15612, -15613, -15613, -15613, -15613, -15613, -15613, -15613,
+    -15613, -15613, -15613, -15613, -15613, -15613, -15613, -15612, -15612, -15612, -15612, -15612, -15612, -15612, -15612, 0,
+    0, 15611, 15611, 15611, 15611, 15611, 15611, 15611, 15610, 15610, 15610, -15611, -15611, -15611, -15611, -15611,
+    -15611, -15611, -15611, -15611, -15611, -15611, -15611, -15611, -15611, -15610, -15610, -15610, -15610, -15610, -15610, -15610,
+    -15610, 15609, 15609, 15609, 15609, 15609, 15609, 15609, 15609, 15609, 15608, -5799, -5799, -15609, -15609, -15609,
+    -15609, -15609, -15609, -15609, -15609, -15609, -15609, -15609, -15609, -15609, -15609, -15608, -15608, -15608, -15608, -15608,
+    -15608, -15608, -15608, 15607, 15607, 15607, 15607, 15607, 15607, 15607, 15607, 15607, 15606, -9513, -9513, -15607,
+    -15607, -15607, -15607, -15607, -15607, -15607, -15607, -15607, -15607, -15607, -15607, -15607, -15607, -15606, -15606, -15606,
+    -15606, -15606, -15606, -15606, -15606, 15605, 15605, 15605, 15605, 15605, 15605, 15605, 15605, 15605, 15604, 0,
+    0, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15605, -15604,
+    -15604, -15604, -15604, -15604, -15604, -15604, -15604, 15603, 15603, 15603, 15603, 15603, 15603, 15603, 15603, 15603,
+    15602, 15602, 15602, -15603, -15603, -15603, -15603, -15603, -15603, -15603, -15603, -15603, -15603, -15603, -15603, -15603,
+    -15603, -15602, -15602, -15602, -15602, -15602, -15602, -15602, -15602, -15602, -15602, 15601, 15601, 15601, 15601, 15601,
+    15601, 15601, 15600, 15600, 15600, -5796, -5796, -15601, -15601, -15601, -15601, -15601, -15601, -15601, -15601, -15601,
+    -15601, -15601, -15601, -15600, -15600, -15600, -15600, -15600, -15600, -15600, -15600, -15600, -15600, 5795, 5795, 15599,
+    15599, 15599, 15599, 15599, 15598, 15598, 15598, 15598, 15598, -15599, -15599, -15599, -15599, -15599, -15599, -15599,
+    -15599, -15599, -15599, -15599, -15599, -15598, -15598, -15598, -15598, -15598, -15598, -15598, -15598, -15598, -15598, -15598,
+    -15598, 9506, 9506, 15597, 15597, 15597, 15596, 15596, 15596, 15596, 15596, 15596, 15596, -15597, -15597, -15597,
+    -15597, -15597, -15597, -15597, -15597, -15597, -15597, -15596, -15596, -15596, -15596, -15596, -15596, -15596, -15596, -15596,
+    -15596, -15596, -15596, -15596, -15596, -5794, -5794, 15595, 15594, 15594, 15594, 15594, 15594, 15594, 15594, 15594,
+    15594, 0, 0, -15595, -15595, -15595, -15595, -15595, -15595, -15594, -15594, -15594, -15594, -15594, -15594, -15594,
+    -15594, -15594, -15594, -15594, -15594, -15594, -15594, -15594, -15594, -15594, -15593, 15592, 15592, 15592, 15592, 15592,
+    15592, 15592, 15592, 15592, 15592, 15592, 15592, -15593, -15593, -15593, -15593, -15592, -15592, -15592, -15592, -15592,
+    -15592, -15592, -15592, -15592, -15592, -15592, -15592, -15592, -15592, -15592, -15592, -15592, -15591, -15591, -15591, -12695,
+    -12695, 15590, 15590, 15590, 15590, 15590, 15590, 15590, 15590, 15590, 15590, 15590, 15590, -15590, -15590, -15590,
+    -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15590, -15589, -15589,
+    -15589, -15589, -15589, -15589, -15589, -9502, -9502, 15588, 15588, 15588, 15588, 15588, 15588, 15588, 15588, 15587,
+    15587, 15587, 15587, -15588, -15588, -15588, -15588, -15588, -15588, -15588, -15588, -15588, -15588, -15588, -15588, -15588,
+    -15587, -15587, -15587, -15587, -15587, -15587, -15587, -15587, -15587, -15587, -15587, -15587, -15587, 15586, 15586, 15586,
+    15586, 15585, 15585, 15585, 15585, 15585, 15585, 15585, 15585, -15586, -15586, -15586, -15586, -15586, -15586, -15586,
+    -15586, -15586, -15585, -15585, -15585, -15585, -15585, -15585, -15585, -15585, -15585, -15585, -15585, -15585, -15585, -15585,
+    -15585, -15585, -15585, 15583, 15583, 15583, 15583, 15583, 15583, 15583, 15583, 15583, 15583, 15583, 15583, 15583,
+    15583, -15584, -15584, -15584, -15583, -15583, -15583, -15583, -15583, -15583, -15583, -15583, -15583, -15583, -15583, -15583,
+    -15583, -15583, -15583, -15583, -15583, -15582, -15582, -15582, -15582, -15582, -15582, 15581, 15581, 15581, 15581, 15581,
+    15581, 15581, 15581, 15581, 15581, 15581, 15580, 9496, 9496, -15581, -15581, -15581, -15581, -15581, -15581, -15581,
+    -15581, -15581, -15581, -15581, -15581, -15581, -15581, -15580, -15580, -15580, -15580, -15580, -15580, -15580, -15580, -15580,
+    -15580, -15580, -15580, 15579, 15579, 15579, 15579, 15579, 15578, 15578, 15578, 15578, 15578, 15578, 15578, 15578,
+    15578, -15579, -15579, -15579, -15579, -15579, -15579, -15579, -15579, -15578, -15578, -15578, -15578, -15578, -15578, -15578,
+    -15578, -15578, -15578, -15578, -15578, -15578, -15578, -15578, -15578, -15578, -15577, 12683, 12683, 15576, 15576, 15576,
+    15576, 15576, 15576, 15576, 15576, 15576, 15576, 15576, 15576, -15577, -15577, -15576, -15576, -15576, -15576, -15576,
+    -15576, -15576, -15576, -15576, -15576, -15576, -15576, -15576, -15576, -15576, -15576, -15576, -15575, -15575, -15575, -15575,
+    -15575, -15575, -15575, -15575, -15575, 15574, 15574, 15574, 15574, 15574, 15574, 15574, 15574, 15573, 15573, 15573,
+    15573, 15573, 15573, -15574, -15574, -15574, -15574, -15574, -15574, -15574, -15574, -15574, -15574, -15574, -15573, -15573,
+    -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, -15573, 15571,
+    15571, 15571, 15571, 15571, 15571, 15571, 15571, 15571, 15571, 15571, 15571, 15571, 15571, -15572, -15572, -15572,
+    -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571, -15571,
+    -15571, -15570, -15570, -15570, -15570, -15570, -15570, -15570, -15570, 15569, 15569, 15569, 15569, 15569, 15569, 15569,
+    15569, 15569, 15568, 15568, 15568, 15568, 15568, -9490, -9490, -15569, -15569, -15569, -15569, -15569, -15569, -15569,
+    -15569, -15569, -15569, -15568, -15568, -15568, -15568, -15568, -15568, -15568, -15568, -15568, -15568, -15568, -15568, -15568,
+    -15568, -15568, -15568, -12676, -12676, 15566, 15566, 15566, 15566, 15566, 15566, 15566, 15566, 15566, 15566, 15566,
+    15566, 15566, 15566, -15567, -15567, -15566, -15566, -15566, -15566, -15566, -15566, -15566, -15566, -15566, -15566, -15566,
+    -15566, -15566, -15566, -15566, -15566, -15566, -15565, -15565, -15565, -15565, -15565, -15565, -15565, -15565, -15565, -9487,
+    -9487, 15564, 15564, 15564, 15564, 15564, 15564, 15563, 15563, 15563, 15563, 15563, 15563, 15563, 15563, -15564,
+    -15564, -15564, -15564, -15564, -15564, -15564, -15564, -15564, -15563, -15563, -15563, -15563, -15563, -15563, -15563, -15563,
+    -15563, -15563, -15563, -15563, -15563, -15563, -15563, -15563, -15563, -15562, -15562, -15562, -15562, 15561, 15561, 15561,
+    15561, 15561, 15561, 15561, 15561, 15561, 15561, 15561, 15561, 15561, 15560, 9484, 9484, -15561, -15561, -15561,
+    -15561, -15561, -15561, -15561, -15561, -15561, -15561, -15561, -15561, -15561, -15561, -15560, -15560, -15560, -15560, -15560,
+    -15560, -15560, -15560, -15560, -15560, -15560, -15560, -15560, -15560, -5781, -5781, 15559, 15558, 15558, 15558, 15558,
+    15558, 15558, 15558, 15558, 15558, 15558, 15558, 15558, 15558, -9483, -9483, -15559, -15559, -15558, -15558, -15558,
+    -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15558, -15557, -15557,
+    -15557, -15557, -15557, -15557, -15557, -15557, -15557, -5780, -5780, 15556, 15556, 15556, 15556, 15556, 15556, 15555,
+    15555, 15555, 15555, 15555, 15555, 15555, 15555, 5778, 5778, -15556, -15556, -15556, -15556, -15556, -15556, -15556,
+    -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555, -15555,
+    -15555, -15554, -15554, -15554, -15554, -15554, -15554, 15553, 15553, 15553, 15553, 15553, 15553, 15553, 15553, 15553,
+    15553, 15553, 15552, 15552, 15552, 15552, 15552, -15553, -15553, -15553, -15553, -15553, -15553, -15553, -15553, -15553,
+    -15553, -15553, -15553, -15552, -15552, -15552, -15552, -15552, -15552, -15552, -15552, -15552, -15552, -15552, -15552, -15552,
+    -15552, -15552, -15552, -15552, -15551, -15551, -15551, 15550, 15550, 15550, 15550, 15550, 15550, 15550, 15550, 15550,
+    15550, 15550, 15550, 15550, 15550, 15549, 15549, -15550, -15550, -15550, -15550, -15550, -15550, -15550, -15550, -15550,
+    -15550, -15550, -15550, -15550, -15550, -15550, -15549, -15549, -15549, -15549, -15549, -15549, -15549, -15549, -15549, -15549,
+    -15549, -15549, -15549, -15549, -15549, -15549, -15549, 15547, 15547, 15547, 15547, 15547, 15547, 15547, 15547, 15547,
+    15547, 15547, 15547, 15547, 15547, 15547, 15547, 5775, 5775, -15547, -15547, -15547, -15547, -15547, -15547, -15547,
+    -15547, -15547, -15547, -15547, -15547, -15547, -15547, -15547, -15547, -15546, -15546, -15546, -15546, -15546, -15546, -15546,
+    -15546, -15546, -15546, -15546, -15546, -15546, -15546, -15546, -15546, 15545, 15544, 15544, 15544, 15544, 15544, 15544,
+    15544, 15544, 15544, 15544, 15544, 15544, 15544, 15544, 15544, -5775, -5775, -15544, -15544, -15544, -15544, -15544,
+    -15544, -15544, -15544, -15544, -15544, -15544, -15544, -15544, -15544, -15544, -15544, -15544, -15543, -15543, -15543, -15543,
+    -15543, -15543, -15543, -15543, -15543, -15543, -15543, -15543, -15543, -15543, -15543, 15542, 15542, 15541, 15541, 15541,
+    15541, 15541, 15541, 15541, 15541, 15541, 15541, 15541, 15541, 15541, 15541, 15541, 15541, -15542, -15541, -15541,
+    -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15541, -15540,
+    -15540, -15540, -15540, -15540, -15540, -15540, -15540, -15540, -15540, -15540, -15540, -15540, -15540, 0, 0, 15539,
+    15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 15538, 9470,
+    9470, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538, -15538,
+    -15538, -15538, -15537, -15537, -15537, -15537, -15537, -15537, -15537, -15537, -15537, -15537, -15537, -15537, -15537, -15537,
+    -15537, -5772, -5772, 15535, 15535, 15535, 15535, 15535, 15535, 15535, 15535, 15535, 15535, 15535, 15535, 15535,
+    15535, 15535, 15535, 15535, 15534, -15535, -15535, -15535, -15535, -15535, -15535, -15535, -15535, -15535, -15535, -15535,
+    -15535, -15535, -15535, -15535, -15535, -15534, -15534, -15534, -15534, -15534, -15534, -15534, -15534, -15534, -15534, -15534,
+    -15534, -15534, -15534, -15534, -15534, -15534, -15533, 15532, 15532, 15532, 15532, 15532, 15532, 15532, 15532, 15532,
+    15532, 15532, 15532, 15532, 15532, 15532, 15532, 15531, 15531, 12646, 12646, -15532, -15532, -15532, -15532, -15532,
+    -15532, -15532, -15532, -15532, -15532, -15532, -15532, -15532, -15531, -15531, -15531, -15531, -15531, -15531, -15531, -15531,
+    -15531, -15531, -15531, -15531, -15531, -15531, -15531, -15531, -15531, -15530, -15530, -15530, -15530, 15529, 15529, 15529,
+    15529, 15529, 15529, 15529, 15529, 15529, 15529, 15529, 15529, 15529, 15528, 15528, 15528, 15528, 15528, 15528,
+    15528, -15529, -15529, -15529, -15529, -15529, -15529, -15529, -15529, -15529, -15529, -15528, -15528, -15528, -15528, -15528,
+    -15528, -15528, -15528, -15528, -15528, -15528, -15528, -15528, -15528, -15528, -15528, -15528, -15527, -15527, -15527, -15527,
+    -15527, -15527, -15527, -15527, -15527, 15526, 15526, 15526, 15526, 15526, 15526, 15526, 15526, 15525, 15525, 15525,
+    15525, 15525, 15525, 15525, 15525, 15525, 15525, 15525, 15525, -15526, -15526, -15526, -15526, -15526, -15525, -15525,
+    -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15525, -15524,
+    -15524, -15524, -15524, -15524, -15524, -15524, -15524, -15524, -15524, -15524, -15524, -15524, -15524, 15523, 15523, 15523,
+    15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522, 15522,
+    15522, -9461, -9461, -15522, -15522, -15522, -15522, -15522, -15522, -15522, -15522, -15522, -15522, -15522, -15522, -15522,
+    -15522, -15522, -15521, -15521, -15521, -15521, -15521, -15521, -15521, -15521, -15521, -15521, -15521, -15521, -15521, -15521,
+    -15521, -15521, -15520, -15520, -15520, -15520, -15520, 15519, 15519, 15519, 15519, 15519, 15519, 15519, 15519, 15519,
+    15519, 15519, 15519, 15518, 15518, 15518, 15518, 15518, 15518, 15518, 15518, -5766, -5766, -15519, -15519, -15519,
+    -15519, -15519, -15519, -15519, -15518, -15518, -15518, -15518, -15518, -15518, -15518, -15518, -15518, -15518, -15518, -15518,
+    -15518, -15518, -15518, -15518, -15518, -15517, -15517, -15517, -15517, -15517, -15517, -15517, -15517, -15517, -15517, -15517,
+    -15517, 12634, 12634, 15516, 15516, 15516, 15515, 15515, 15515, 15515, 15515, 15515, 15515, 15515, 15515, 15515,
+    15515, 15515, 15515, 15515, 15515, 15515, 15515, -15515, -15515, -15515, -15515, -15515, -15515, -15515, -15515, -15515,
+    -15515, -15515, -15515, -15515, -15515, -15515, -15515, -15515, -15514, -15514, -15514, -15514, -15514, -15514, -15514, -15514,
+    -15514, -15514, -15514, -15514, -15514, -15514, -15514, -15514, -15514, -15513, -15513, -15513, -15513, 9455, 9455, 15512,
+    15512, 15512, 15512, 15512, 15512, 15512, 15512, 15512, 15512, 15512, 15511, 15511, 15511, 15511, 15511, 15511,
+    15511, 15511, 15511, 0, 0, -15512, -15512, -15512, -15512, -15512, -15512, -15511, -15511, -15511, -15511, -15511,
+    -15511, -15511, -15511, -15511, -15511, -15511, -15511, -15511, -15511, -15511, -15511, -15511, -15510, -15510, -15510, -15510,
+    -15510, -15510, -15510, -15510, -15510, -15510, -15510, -15510, -15510, -15510, -15510, 15509, 15509, 15508, 15508, 15508,
+    15508, 15508, 15508, 15508, 15508, 15508, 15508, 15508, 15508, 15508, 15508, 15508, 15508, 15508, 15507, 15507,
+    15507, 5761, 5761, -15508, -15508, -15508, -15508, -15508, -15508, -15508, -15508, -15508, -15508, -15508, -15508, -15507,
+    -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507, -15507,
+    -15506, -15506, -15506, -15506, -15506, -15506, -15506, -15506, -15506, -5761, -5761, 15505, 15505, 15505, 15505, 15505,
+    15505, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504, 15504,
+    15504, -12625, -12625, -15504, -15504, -15504, -15504, -15504, -15504, -15504, -15504, -15504, -15504, -15504, -15504, -15504,
+    -15504, -15504, -15504, -15503, -15503, -15503, -15503, -15503, -15503, -15503, -15503, -15503, -15503, -15503, -15503, -15503,
+    -15503, -15503, -15503, -15503, -15502, -15502, -15502, -15502, -15502, -15502, -15502, 15501, 15501, 15501, 15501, 15501,
+    15501, 15501, 15501, 15501, 15501, 15500, 15500, 15500, 15500, 15500, 15500, 15500, 15500, 15500, 15500, 15500,
+    15500, 15500, 15500, -15501, -15501, -15501, -15500, -15500, -15500, -15500, -15500, -15500, -15500, -15500, -15500, -15500,
+    -15500, -15500, -15500, -15500, -15500, -15500, -15500, -15499, -15499, -15499, -15499, -15499, -15499, -15499, -15499, -15499,
+    -15499, -15499, -15499, -15499, -15499, -15499, -15499, -15499, -15498, -15498, -15498, -12620, -12620, 15497, 15497, 15497,
+    15497, 15497, 15497, 15497, 15497, 15497, 15497, 15497, 15497, 15496, 15496, 15496, 15496, 15496, 15496, 15496,
+    15496, 15496, 15496, 15496, 15496, -15497, -15497, -15497, -15497, -15497, -15496, -15496, -15496, -15496, -15496, -15496,
+    -15496, -15496, -15496, -15496, -15496, -15496, -15496, -15496, -15496, -15496, -15496, -15495, -15495, -15495, -15495, -15495,
+    -15495, -15495, -15495, -15495, -15495, -15495, -15495, -15495, -15495, -15495, -15495, -15495, -15494, -15494, -15494, 5755,
+    5755, 15493, 15493, 15493, 15493, 15493, 15493, 15493, 15493, 15493, 15493, 15493, 15493, 15492, 15492, 15492,
+    15492, 15492, 15492, 15492, 15492, 15492, 15492, 15492, 15492, -15493, -15493, -15493, -15493, -15493, -15492, -15492,
+    -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15492, -15491,
+    -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491, -15491,
+    -15490, -15490, -15490, -15490, -15490, 15489, 15489, 15489, 15489, 15489, 15489, 15489, 15489, 15489, 15489, 15489,
+    15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, 15488, -15489,
+    -15489, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488, -15488,
+    -15488, -15488, -15487, -15487, -15487, -15487, -15487, -15487, -15487, -15487, -15487, -15487, -15487, -15487, -15487, -15487,
+    -15487, -15487, -15487, -15486, -15486, -15486, -15486, -15486, -15486, -15486, -15486, -5753, -5753, 15485, 15485, 15485,
+    15485, 15485, 15485, 15485, 15484, 15484, 15484, 15484, 15484, 15484, 15484, 15484, 15484, 15484, 15484, 15484,
+    15484, 15484, 15484, 15484, 15484, 15483, 15483, -15484, -15484, -15484, -15484, -15484, -15484, -15484, -15484, -15484,
+    -15484, -15484, -15484, -15484, -15484, -15484, -15483, -15483, -15483, -15483, -15483, -15483, -15483, -15483, -15483, -15483,
+    -15483, -15483, -15483, -15483, -15483, -15483, -15483, -15482, -15482, -15482, -15482, -15482, -15482, -15482, -15482, -15482,
+    -15482, -15482, -15482, -15482, -15482, 15481, 15481, 15481, 15480, 15480, 15480, 15480, 15480, 15480, 15480, 15480,
+    15480, 15480, 15480, 15480, 15480, 15480, 15480, 15480, 15480, 15479, 15479, 15479, 15479, 15479, 15479, 15479,
+    15479, -15480, -15480, -15480, -15480, -15480, -15480, -15480, -15480, -15480, -15479, -15479, -15479, -15479, -15479, -15479,
+    -15479, -15479, -15479, -15479, -15479, -15479, -15479, -15479, -15479, -15479, -15479, -15478, -15478, -15478, -15478, -15478,
+    -15478, -15478, -15478, -15478, -15478, -15478, -15478, -15478, -15478, -15478, -15478, -15478, -15477, -15477, -15477, 5749,
+    5749, 15476, 15476, 15476, 15476, 15476, 15476, 15476, 15476, 15476, 15476, 15476, 15476, 15475, 15475, 15475,
+    15475, 15475, 15475, 15475, 15475, 15475, 15475, 15475, 15475, 15475, 15475, 15475, 15475, -15476, -15475, -15475,
+    -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15475, -15474,
+    -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474, -15474,
+    -15473, -15473, -15473, -15473, -15473, -15473, -15473, -15473, -15473, -15473, -15473, -15473, -15473, 15472, 15472, 15472,
+    15472, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471, 15471,
+    15471, 15471, 15470, 15470, 15470, 15470, 15470, 15470, 15470, 15470, 15470, -15471, -15471, -15471, -15471, -15471,
+    -15471, -15471, -15471, -15470, -15470, -15470, -15470, -15470, -15470, -15470, -15470, -15470, -15470, -15470, -15470, -15470,
+    -15470, -15470, -15470, -15470, -15469, -15469, -15469, -15469, -15469, -15469, -15469, -15469, -15469, -15469, -15469, -15469,
+    -15469, -15469, -15469, -15469, -15469, -15468, -15468, -15468, -15468, -15468, -15468, -5747, -5747, 15467, 15467, 15467,
+    15467, 15467, 15467, 15467, 15467, 15467, 15466, 15466, 15466, 15466, 15466, 15466, 15466, 15466, 15466, 15466,
+    15466, 15466, 15466, 15466, 15466, 15466, 15465, 15465, 15465, 15465, 15465, -15466, -15466, -15466, -15466, -15466,
+    -15466, -15466, -15466, -15466, -15466, -15466, -15466, -15465, -15465, -15465, -15465, -15465, -15465, -15465, -15465, -15465,
+    -15465, -15465, -15465, -15465, -15465, -15465, -15465, -15465, -15464, -15464, -15464, -15464, -15464, -15464, -15464, -15464,
+    -15464, -15464, -15464, -15464, -15464, -15464, -15464, -15464, -15464, -15463, -15463, -15463, -15463, 9424, 9424, 15462,
+    15462, 15462, 15462, 15462, 15462, 15462, 15462, 15462, 15462, 15462, 15461, 15461, 15461, 15461, 15461, 15461,
+    15461, 15461, 15461, 15461, 15461, 15461, 15461, 15461, 15461, 15461, 15461, 15460, 15460, 0, 0, -15461,
+    -15461, -15461, -15461, -15461, -15461, -15461, -15461, -15461, -15461, -15461, -15461, -15461, -15460, -15460, -15460, -15460,
+    -15460, -15460, -15460, -15460, -15460, -15460, -15460, -15460, -15460, -15460, -15460, -15460, -15460, -15459, -15459, -15459,
+    -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15459, -15458, -15458,
+    -15458, 5742, 5742, 15457, 15457, 15457, 15457, 15457, 15457, 15457, 15457, 15457, 15457, 15457, 15457, 15456,
+    15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456, 15456,
+    15455, 15455, 15455, -15456, -15456, -15456, -15456, -15456, -15456, -15456, -15456, -15456, -15456, -15456, -15456, -15456,
+    -15456, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455, -15455,
+    -15455, -15455, -15454, -15454, -15454, -15454, -15454, -15454, -15454, -15454, -15454, -15454, -15454, -15454, -15454, -15454,
+    -15454, -15454, -15454, -15453, -15453, -15453, -15453, -15453, -15453, 15452, 15452, 15452, 15452, 15452, 15452, 15452,
+    15452, 15452, 15452, 15452, 15451, 15451, 15451, 15451, 15451, 15451, 15451, 15451, 15451, 15451, 15451, 15451,
+    15451, 15451, 15451, 15451, 15451, 15450, 15450, 15450, 15450, 15450, 15450, -15451, -15451, -15451, -15451, -15451,
+    -15451, -15451, -15451, -15451, -15451, -15451, -15450, -15450, -15450, -15450, -15450, -15450, -15450, -15450, -15450, -15450,
+    -15450, -15450, -15450, -15450, -15450, -15450, -15450, -15449, -15449, -15449, -15449, -15449, -15449, -15449, -15449, -15449,
+    -15449, -15449, -15449, -15449, -15449, -15449, -15449, -15448, -15448, -15448, -15448, -15448, -15448, -15448, -15448, -15448,
+    -15448, -9416, -9416, 15447, 15447, 15447, 15447, 15447, 15446, 15446, 15446, 15446, 15446, 15446, 15446, 15446,
+    15446, 15446, 15446, 15446, 15446, 15446, 15446, 15446, 15446, 15445, 15445, 15445, 15445, 15445, 15445, 15445,
+    15445, 15445, 15445, 15445, 15445, 15445, 15445, -15446, -15446, -15446, -15445, -15445, -15445, -15445, -15445, -15445,
+    -15445, -15445, -15445, -15445, -15445, -15445, -15445, -15445, -15445, -15445, -15445, -15444, -15444, -15444, -15444, -15444,
+    -15444, -15444, -15444, -15444, -15444, -15444, -15444, -15444, -15444, -15444, -15444, -15444, -15443, -15443, -15443, -15443,
+    -15443, -15443, -15443, -15443, -15443, -15443, -15443, -15443, -15443, -15443, -15443, -15443, -15443, -15442, -15442, 15441,
+    15441, 15441, 15441, 15441, 15441, 15441, 15441, 15441, 15441, 15441, 15441, 15441, 15441, 15441, 15440, 15440,
+    15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15440, 15439,
+    15439, 15439, 15439, 15439, 15439, -15440, -15440, -15440, -15440, -15440, -15440, -15440, -15440, -15440, -15440, -15440,
+    -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439, -15439,
+    -15439, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438, -15438,
+    -15438, -15438, -15437, -15437, -15437, -15437, -15437, -15437, -15437, -15437, -15437, -15437, -15437, -15437, -15437, 15436,
+    15436, 15436, 15436, 15435, 15435, 15435, 15435, 15435, 15435, 15435, 15435, 15435, 15435, 15435, 15435, 15435,
+    15435, 15435, 15435, 15435, 15434, 15434, 15434, 15434, 15434, 15434, 15434, 15434, 15434, 15434, 15434, 15434,
+    15434, 15434, 15434, 15434, 15434, 5733, 5733, -15434, -15434, -15434, -15434, -15434, -15434, -15434, -15434, -15434,
+    -15434, -15434, -15434, -15434, -15434, -15434, -15433, -15433, -15433, -15433, -15433, -15433, -15433, -15433, -15433, -15433,
+    -15433, -15433, -15433, -15433, -15433, -15433, -15433, -15432, -15432, -15432, -15432, -15432, -15432, -15432, -15432, -15432,
+    -15432, -15432, -15432, -15432, -15432, -15432, -15432, -15431, -15431, -15431, -15431, -15431, -15431, -15431, -15431, -15431,
+    -15431, -5733, -5733, 15430, 15430, 15430, 15430, 15430, 15429, 15429, 15429, 15429, 15429, 15429, 15429, 15429,
+    15429, 15429, 15429, 15429, 15429, 15429, 15429, 15429, 15429, 15428, 15428, 15428, 15428, 15428, 15428, 15428,
+    15428, 15428, 15428, 15428, 15428, 15428, 15428, 15428, 15428, 15428, 15427, -15428, -15428, -15428, -15428, -15428,
+    -15428, -15428, -15428, -15428, -15428, -15428, -15428, -15428, -15428, -15428, -15428, -15427, -15427, -15427, -15427, -15427,
+    -15427, -15427, -15427, -15427, -15427, -15427, -15427, -15427, -15427, -15427, -15427, -15427, -15426, -15426, -15426, -15426,
+    -15426, -15426, -15426, -15426, -15426, -15426, -15426, -15426, -15426, -15426, -15426, -15426, -15426, -15425, -15425, -15425,
+    -15425, -15425, -15425, -15425, -15425, -15425, -15425, -15425, -15425, 15424, 15424, 15424, 15424, 15424, 15423, 15423,
+    15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15423, 15422,
+    15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422, 15422,
+    15421, 15421, 15421, 11023, 11023, -15422, -15422, -15422, -15422, -15422, -15422, -15422, -15422, -15422, -15422, -15422,
+    -15422, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421, -15421,
+    -15421, -15421, -15420, -15420, -15420, -15420, -15420, -15420, -15420, -15420, -15420, -15420, -15420, -15420, -15420, -15420,
+    -15420, -15420, -15420, -15419, -15419, -15419, -15419, -15419, -15419, -15419, -15419, -15419, -15419, -15419, -15419, -15419,
+    -15419, -15419, -15419, -14016, -14016, 15417, 15417, 15417, 15417, 15417, 15417, 15417, 15417, 15417, 15417, 15417,
+    15417, 15417, 15417, 15417, 15417, 15416, 15416, 15416, 15416, 15416, 15416, 15416, 15416, 15416, 15416, 15416,
+    15416, 15416, 15416, 15416, 15416, 15415, 15415, 15415, 15415, 15415, 15415, 15415, 15415, 15415, 15415, 15415,
+    15415, -15416, -15416, -15416, -15416, -15416, -15415, -15415, -15415, -15415, -15415, -15415, -15415, -15415, -15415, -15415,
+    -15415, -15415, -15415, -15415, -15415, -15415, -15415, -15414, -15414, -15414, -15414, -15414, -15414, -15414, -15414, -15414,
+    -15414, -15414, -15414, -15414, -15414, -15414, -15414, -15414, -15413, -15413, -15413, -15413, -15413, -15413, -15413, -15413,
+    -15413, -15413, -15413, -15413, -15413, -15413, -15413, -15413, -15413, -15412, -15412, -15412, -15412, -15412, -15412, -15412,
+    -15412, -15412, -15412, 3489, 3489, 15411, 15411, 15411, 15411, 15411, 15410, 15410, 15410, 15410, 15410, 15410,
+    15410, 15410, 15410, 15410, 15410, 15410, 15410, 15410, 15410, 15410, 15410, 15409, 15409, 15409, 15409, 15409,
+    15409, 15409, 15409, 15409, 15409, 15409, 15409, 15409, 15409, 15409, 15409, 15409, 15408, 15408, 15408, 15408,
+    15408, 15408, 15408, -15409, -15409, -15409, -15409, -15409, -15409, -15409, -15409,
+};
@@ -1,10 +1,42 @@
 #include "raylib.h"
+#include "rlgl.h"
+#include "embedded_sounds.h"
 #include <vector>
+#include <array>
 #include <cmath>
 #include <algorithm>
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <chrono>
+#include <ctime>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cstdarg>
+#include <cstddef>
+#include <atomic>
+#include <new>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <unordered_map>
+#include <tuple>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define VD_SIMD_SSE2
+    #if defined(__AVX__)
+        #include <immintrin.h>
+        #define VD_SIMD_AVX
+    #endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define VD_SIMD_NEON
+#endif
 
 // --- CONSTANTS & CONFIGURATION ---
 const int SCREEN_WIDTH = 1280;
@@ -13,6 +45,37 @@ const float CORE_RADIUS = 50.0f;
 const float EXCLUSION_RADIUS = CORE_RADIUS + 35.0f; 
 const int UI_HEADER_HEIGHT = 60;
 const int UI_FOOTER_HEIGHT = 85;
+const float SIM_DT = 1.0f / 60.0f; // Fixed step used by headless runs
+const int ALLOC_WARMUP_FRAMES = 120; // Gameplay frames before --alloc-assert starts checking
+
+// --- ALLOCATION COUNTER ---
+// Counts every global operator new so benchmarks can report allocations per frame. Building
+// with -DVD_ALLOC_TRACKING also charges each allocation and its size to the profiler stage
+// open on the allocating thread (slot 0 when none is), for the [F3] overlay.
+std::atomic<uint64_t> gAllocationCount{ 0 };
+#if defined(VD_ALLOC_TRACKING)
+const bool ALLOC_TRACKING = true;
+#else
+const bool ALLOC_TRACKING = false;
+#endif
+const int ALLOC_SLOTS = 16;
+std::atomic<uint64_t> gAllocsBySlot[ALLOC_SLOTS] = {}, gAllocBytesBySlot[ALLOC_SLOTS] = {};
+thread_local int gAllocSlot = 0;
+
+// Kept out of line so GCC doesn't see malloc()/free() behind new/delete and warn about a mismatch.
+#if defined(__GNUC__)
+    #define VD_NOINLINE __attribute__((noinline))
+#else
+    #define VD_NOINLINE
+#endif
+VD_NOINLINE void* operator new(std::size_t size) {
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if constexpr (ALLOC_TRACKING) { gAllocsBySlot[gAllocSlot].fetch_add(1, std::memory_order_relaxed); gAllocBytesBySlot[gAllocSlot].fetch_add(size, std::memory_order_relaxed); }
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+VD_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+VD_NOINLINE void operator delete(void* p, std::size_t) noexcept { std::free(p); }
 
 // --- COLOR PALETTE ---
 const Color V_CYAN      = { 0, 255, 255, 255 };
@@ -69,7 +132,7 @@ struct MenuShape {
 };
 
 struct Notification {
-    std::string text; float timer; Color col;
+    char text[32]; float timer; Color col; // inline text, so a notification never hits the heap
 };
 
 struct ScoreEntry {
@@ -78,475 +141,3406 @@ struct ScoreEntry {
 };
 
 // --- GLOBAL ASSETS & SHADERS ---
-Sound sndBlip, sndBoom, sndShoot;
+// Bloom chain: bright-pass -> downsampled separable Gaussian (ping-pong) -> composite.
+const char* bloomBrightShaderCode =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "out vec4 finalColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform float threshold;\n"
+    "void main() {\n"
+    "    vec3 c = texture(texture0, fragTexCoord).rgb;\n"
+    "    float peak = max(c.r, max(c.g, c.b));\n"
+    "    finalColor = vec4(c * smoothstep(threshold, threshold + 0.25, peak), 1.0);\n"
+    "}\n";
+
+// 9-tap Gaussian folded into 5 bilinear fetches; `direction` is one texel along the blur axis.
+const char* bloomBlurShaderCode =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "out vec4 finalColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec2 direction;\n"
+    "void main() {\n"
+    "    vec3 sum = texture(texture0, fragTexCoord).rgb * 0.2270270270;\n"
+    "    sum += texture(texture0, fragTexCoord + direction * 1.3846153846).rgb * 0.3162162162;\n"
+    "    sum += texture(texture0, fragTexCoord - direction * 1.3846153846).rgb * 0.3162162162;\n"
+    "    sum += texture(texture0, fragTexCoord + direction * 3.2307692308).rgb * 0.0702702703;\n"
+    "    sum += texture(texture0, fragTexCoord - direction * 3.2307692308).rgb * 0.0702702703;\n"
+    "    finalColor = vec4(sum, 1.0);\n"
+    "}\n";
 
-const char* bloomShaderCode = 
+const char* bloomCompositeShaderCode =
     "#version 330\n"
     "in vec2 fragTexCoord;\n"
     "in vec4 fragColor;\n"
     "out vec4 finalColor;\n"
     "uniform sampler2D texture0;\n"
+    "uniform sampler2D bloomTexture;\n"
+    "uniform float intensity;\n"
     "void main() {\n"
     "    vec4 base = texture(texture0, fragTexCoord);\n"
-    "    vec4 bloom = vec4(0.0);\n"
-    "    float size = 0.002;\n"
-    "    bloom += texture(texture0, fragTexCoord + vec2(-size, -size)) * 0.15;\n"
-    "    bloom += texture(texture0, fragTexCoord + vec2(size, -size)) * 0.15;\n"
-    "    bloom += texture(texture0, fragTexCoord + vec2(-size, size)) * 0.15;\n"
-    "    bloom += texture(texture0, fragTexCoord + vec2(size, size)) * 0.15;\n"
-    "    finalColor = base + (bloom * 0.8);\n"
+    "    finalColor = vec4(base.rgb + texture(bloomTexture, fragTexCoord).rgb * intensity, base.a);\n"
     "}\n";
 
 // --- PERSISTENT STORAGE ---
-std::vector<ScoreEntry> highScores;
+// The Hall of Fame keeps only the top LEADERBOARD_SIZE entries, in memory and on disk.
+// scores.dat is a fixed header plus fixed-size records, so it never grows past ~200 bytes.
+// Saves hand a copy to a writer thread that replaces the file atomically
+// (temp file + rename), so the frame never waits on the disk and a crash can't truncate it.
+const int LEADERBOARD_SIZE = 10;
+const int SCORE_NAME_LEN = 16; // Name entry caps at 12 characters
+const char* SCORE_FILE = "scores.dat";
+const char* SCORE_TEMP_FILE = "scores.dat.tmp";
+const char* LEGACY_SCORE_FILE = "scores.txt";
+const uint32_t SCORE_MAGIC = 0x53484456; // "VDHS"
+const uint32_t SCORE_VERSION = 1;
+
+struct ScoreFileHeader { uint32_t magic, version, count; };
+struct ScoreRecord { char name[SCORE_NAME_LEN]; int32_t score; };
+
+std::vector<ScoreEntry> highScores; // Sorted by descending score, ties keep the older entry first
+uint32_t highScoresVersion = 0;      // Bumped on every change, keys the cached Hall of Fame panel
+
+// Returns false if the score doesn't make the board.
+bool InsertHighScore(const std::string& name, int score) {
+    if ((int)highScores.size() >= LEADERBOARD_SIZE && score <= highScores.back().score) return false;
+    auto at = std::upper_bound(highScores.begin(), highScores.end(), score, [](int s, const ScoreEntry& e) { return s > e.score; });
+    highScores.insert(at, { name.substr(0, SCORE_NAME_LEN - 1), score });
+    if ((int)highScores.size() > LEADERBOARD_SIZE) highScores.pop_back();
+    highScoresVersion++;
+    return true;
+}
+
+bool WriteScoreFile(const std::vector<ScoreRecord>& records) {
+    {
+        std::ofstream file(SCORE_TEMP_FILE, std::ios::binary | std::ios::trunc);
+        ScoreFileHeader header = { SCORE_MAGIC, SCORE_VERSION, (uint32_t)records.size() };
+        file.write((const char*)&header, sizeof(header));
+        if (!records.empty()) file.write((const char*)records.data(), records.size() * sizeof(ScoreRecord));
+        if (!file.flush()) return false;
+    }
+#if defined(_WIN32)
+    std::remove(SCORE_FILE); // rename() doesn't replace an existing file on Windows
+#endif
+    return std::rename(SCORE_TEMP_FILE, SCORE_FILE) == 0;
+}
+
+struct ScoreWriter {
+    std::mutex lock; std::condition_variable wake;
+    std::vector<ScoreRecord> pending;
+    bool dirty = false, stopping = false;
+    std::thread thread;
+
+    void Submit(const std::vector<ScoreEntry>& entries) {
+        std::vector<ScoreRecord> records(entries.size());
+        for (size_t i = 0; i < entries.size(); i++) {
+            std::memset(records[i].name, 0, SCORE_NAME_LEN);
+            std::memcpy(records[i].name, entries[i].name.data(), std::min(entries[i].name.size(), (size_t)SCORE_NAME_LEN - 1));
+            records[i].score = entries[i].score;
+        }
+        { std::lock_guard<std::mutex> lk(lock); pending.swap(records); dirty = true; }
+        if (!thread.joinable()) thread = std::thread([this] { Loop(); });
+        wake.notify_one();
+    }
+
+    // Only the newest board is written if saves arrive faster than the disk.
+    void Loop() {
+        std::unique_lock<std::mutex> lk(lock);
+        while (true) {
+            wake.wait(lk, [this] { return dirty || stopping; });
+            if (!dirty) return;
+            std::vector<ScoreRecord> records; records.swap(pending); dirty = false;
+            lk.unlock();
+            if (!WriteScoreFile(records)) TraceLog(LOG_WARNING, "SCORES: failed to write %s", SCORE_FILE);
+            lk.lock();
+        }
+    }
+
+    // Flushes any pending write before returning.
+    void Stop() {
+        { std::lock_guard<std::mutex> lk(lock); stopping = true; }
+        wake.notify_one();
+        if (thread.joinable()) thread.join();
+    }
+    ~ScoreWriter() { Stop(); }
+};
+
+ScoreWriter scoreWriter;
+
+// Pre-binary scores.txt held "name score" lines; the score is the last token, so names
+// containing spaces still parse. Migrated into scores.dat the first time it's missing.
+void LoadLegacyScores() {
+    std::ifstream file(LEGACY_SCORE_FILE);
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t split = line.find_last_of(' ');
+        if (split == std::string::npos || split == 0) continue;
+        char* end = nullptr; long score = std::strtol(line.c_str() + split + 1, &end, 10);
+        if (end == line.c_str() + split + 1) continue;
+        InsertHighScore(line.substr(0, split), (int)score);
+    }
+    if (!highScores.empty()) scoreWriter.Submit(highScores);
+}
 
 void LoadHighScores() {
     highScores.clear();
-    std::ifstream file("scores.txt");
-    std::string name;
-    int score;
-    while (file >> name >> score) highScores.push_back({name, score});
-    file.close();
-    std::sort(highScores.begin(), highScores.end(), [](const ScoreEntry& a, const ScoreEntry& b) { return a.score > b.score; });
+    std::ifstream file(SCORE_FILE, std::ios::binary);
+    ScoreFileHeader header;
+    if (!file.read((char*)&header, sizeof(header)) || header.magic != SCORE_MAGIC || header.version != SCORE_VERSION) { LoadLegacyScores(); return; }
+    ScoreRecord record;
+    for (uint32_t i = 0; i < header.count && file.read((char*)&record, sizeof(record)); i++) {
+        record.name[SCORE_NAME_LEN - 1] = '\0';
+        InsertHighScore(record.name, record.score);
+    }
+}
+
+void SaveScore(const char* name, int score) {
+    if (InsertHighScore(name[0] ? name : "ANONYMOUS", score)) scoreWriter.Submit(highScores);
+}
+
+// --- TEXT CACHE & UI PANELS ---
+// DrawText() re-decodes, re-measures and looks up every glyph on each call. The cache keeps
+// the measured width and the glyph quads of each (text, size, font) it has seen, and emits
+// them as one textured quad batch. Layouts match DrawText/MeasureText for the default font.
+struct GlyphQuad { float u0, v0, u1, v1, x0, y0, x1, y1; }; // Offsets relative to the text origin
+
+struct TextLayout {
+    char text[64]; int size = 0; unsigned int fontId = 0; uint64_t key = 0;
+    int width = 0;
+    bool fallback = false; // Font atlas unavailable (or text too long to cache): draw through DrawText() instead
+    int firstQuad = 0, quadCount = 0; // Range in TextCache::quads
+};
+
+// All storage is sized once, so a miss copies into fixed slots instead of allocating.
+struct TextCache {
+    static const int MAX_ENTRIES = 1024; // Numbers in the HUD keep minting new strings; start over past this
+    static const int TABLE_SIZE = 2048;  // Open-addressed entry index, power of two
+    static const int MAX_QUADS = 32768;
+    static const int MAX_TEXT = (int)sizeof(TextLayout::text) - 1; // Longer strings bypass the cache
+    std::vector<TextLayout> entries;
+    std::vector<GlyphQuad> quads;
+    std::vector<int> table;
+    int entryCount = 0, quadCount = 0;
+    TextLayout uncached;
+
+    TextCache() : entries(MAX_ENTRIES), quads(MAX_QUADS), table(TABLE_SIZE, -1) {}
+
+    static uint64_t Key(const char* text, int size, unsigned int fontId) {
+        uint64_t h = 1469598103934665603ULL ^ ((uint64_t)fontId << 32) ^ (uint64_t)size;
+        for (const char* c = text; *c; c++) { h ^= (unsigned char)*c; h *= 1099511628211ULL; }
+        return h;
+    }
+
+    void Clear() { std::fill(table.begin(), table.end(), -1); entryCount = quadCount = 0; }
+
+    const TextLayout& Get(const char* text, int size) {
+        Font font = GetFontDefault();
+        int len = (int)strlen(text);
+        if (len > MAX_TEXT) { uncached.width = MeasureText(text, size); uncached.fallback = true; return uncached; }
+        uint64_t key = Key(text, size, font.texture.id);
+        int slot = (int)(key & (TABLE_SIZE - 1));
+        for (; table[slot] >= 0; slot = (slot + 1) & (TABLE_SIZE - 1)) {
+            const TextLayout& e = entries[table[slot]];
+            if (e.key == key && e.size == size && e.fontId == font.texture.id && strcmp(e.text, text) == 0) return e;
+        }
+        if (entryCount >= MAX_ENTRIES || quadCount + len > MAX_QUADS) { Clear(); slot = (int)(key & (TABLE_SIZE - 1)); }
+        table[slot] = entryCount;
+        TextLayout& layout = entries[entryCount++];
+        memcpy(layout.text, text, len + 1); layout.size = size; layout.fontId = font.texture.id; layout.key = key;
+        layout.width = MeasureText(text, size); layout.firstQuad = quadCount; layout.quadCount = 0;
+        layout.fallback = font.recs == nullptr || font.glyphs == nullptr || font.texture.width == 0;
+        if (layout.fallback) return layout;
+
+        // Mirrors DrawText(): default font size floor of 10, integer spacing of size/10.
+        int fontSize = std::max(size, 10), spacing = fontSize / 10;
+        float scale = (float)fontSize / (float)font.baseSize, pad = (float)font.glyphPadding, x = 0.0f;
+        float tw = (float)font.texture.width, th = (float)font.texture.height;
+        for (const char* c = text; *c; c++) {
+            int idx = GetGlyphIndex(font, (unsigned char)*c);
+            const Rectangle& r = font.recs[idx]; const GlyphInfo& g = font.glyphs[idx];
+            if (*c != ' ' && *c != '\t') {
+                float x0 = x + g.offsetX * scale - pad * scale, y0 = g.offsetY * scale - pad * scale;
+                quads[quadCount++] = { (r.x - pad) / tw, (r.y - pad) / th, (r.x + r.width + pad) / tw, (r.y + r.height + pad) / th,
+                                       x0, y0, x0 + (r.width + 2 * pad) * scale, y0 + (r.height + 2 * pad) * scale };
+            }
+            x += (g.advanceX == 0 ? r.width * scale : g.advanceX * scale) + spacing;
+        }
+        layout.quadCount = quadCount - layout.firstQuad;
+        return layout;
+    }
+};
+
+TextCache textCache;
+
+int MeasureTextCached(const char* text, int size) { return textCache.Get(text, size).width; }
+
+void DrawTextCached(const char* text, int posX, int posY, int size, Color col) {
+    const TextLayout& layout = textCache.Get(text, size);
+    if (layout.fallback) { DrawText(text, posX, posY, size, col); return; }
+    if (layout.quadCount == 0) return;
+    float ox = (float)posX, oy = (float)posY;
+    rlCheckRenderBatchLimit(layout.quadCount * 4);
+    rlSetTexture(GetFontDefault().texture.id);
+    rlBegin(RL_QUADS);
+        rlColor4ub(col.r, col.g, col.b, col.a);
+        for (int i = layout.firstQuad; i < layout.firstQuad + layout.quadCount; i++) {
+            const GlyphQuad& q = textCache.quads[i];
+            rlTexCoord2f(q.u0, q.v0); rlVertex2f(ox + q.x0, oy + q.y0);
+            rlTexCoord2f(q.u0, q.v1); rlVertex2f(ox + q.x0, oy + q.y1);
+            rlTexCoord2f(q.u1, q.v1); rlVertex2f(ox + q.x1, oy + q.y1);
+            rlTexCoord2f(q.u1, q.v0); rlVertex2f(ox + q.x1, oy + q.y0);
+        }
+    rlEnd();
+    rlSetTexture(0);
 }
 
-void SaveScore(std::string name, int score) {
-    if (name.empty()) name = "ANONYMOUS";
-    std::ofstream file("scores.txt", std::ios::app);
-    file << name << " " << score << "\n";
-    file.close();
-    LoadHighScores();
+// BeginTextureMode()/EndTextureMode() leave the modelview at identity. A pass run while the
+// HUD camera is active goes through this so the caller's transform survives it.
+template <typename Fn>
+void TexturePass(const RenderTexture2D& target, Fn&& draw) {
+    Matrix outer = rlGetMatrixModelview();
+    BeginTextureMode(target); draw(); EndTextureMode();
+    rlSetMatrixModelview(outer);
 }
 
+// A full-screen layer painted once into a RenderTexture and then blitted, repainted only
+// when the caller's `inputs` key changes (a new high score, a currency change, ...). The
+// texture holds the canvas at `pixelScale` native pixels per unit, so text stays sharp in a
+// large window.
+struct CachedPanel {
+    RenderTexture2D target = {};
+    uint64_t inputs = 0;
+    bool loaded = false, valid = false;
+
+    template <typename Fn>
+    void Draw(uint64_t key, Fn&& paint, float pixelScale = 1.0f) {
+        int w = std::max(1, (int)roundf(SCREEN_WIDTH * pixelScale)), h = std::max(1, (int)roundf(SCREEN_HEIGHT * pixelScale));
+        if (loaded && (target.texture.width != w || target.texture.height != h)) Unload();
+        if (!loaded) { target = LoadRenderTexture(w, h); SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR); loaded = true; }
+        if (!valid || key != inputs) {
+            TexturePass(target, [&] { ClearBackground(BLANK); rlPushMatrix(); rlScalef(pixelScale, pixelScale, 1.0f); paint(); rlPopMatrix(); });
+            inputs = key; valid = true;
+        }
+        DrawTexturePro(target.texture, { 0, 0, (float)w, -(float)h }, { 0, 0, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT }, { 0, 0 }, 0.0f, WHITE);
+    }
+    void Unload() { if (loaded) UnloadRenderTexture(target); loaded = valid = false; }
+};
+
+// --- FRAME ARENA ---
+// Bump allocator for scratch data that lives for one frame (composed UI strings and the
+// like). Reset at the top of every frame; a request that doesn't fit returns nullptr.
+struct FrameArena {
+    static const size_t CAPACITY = 64 * 1024;
+    std::vector<unsigned char> buffer;
+    size_t used = 0;
+
+    FrameArena() : buffer(CAPACITY) {}
+    void Reset() { used = 0; }
+
+    void* Alloc(size_t bytes, size_t align = alignof(std::max_align_t)) {
+        size_t start = (used + align - 1) & ~(align - 1);
+        if (start + bytes > CAPACITY) return nullptr;
+        used = start + bytes; return buffer.data() + start;
+    }
+
+    // printf into the arena. Falls back to a static "" when full so callers can draw it unconditionally.
+    const char* Format(const char* fmt, ...) {
+        va_list args; va_start(args, fmt);
+        int n = vsnprintf(nullptr, 0, fmt, args); va_end(args);
+        char* out = n >= 0 ? (char*)Alloc((size_t)n + 1, 1) : nullptr;
+        if (!out) return "";
+        va_start(args, fmt); vsnprintf(out, (size_t)n + 1, fmt, args); va_end(args);
+        return out;
+    }
+};
+
+FrameArena frameArena;
+
 // --- CORE UTILITIES ---
-float GetDistance(Vector2 v1, Vector2 v2) { return sqrtf(powf(v2.x - v1.x, 2) + powf(v2.y - v1.y, 2)); }
+float GetDistanceSqr(Vector2 v1, Vector2 v2) { float dx = v2.x - v1.x, dy = v2.y - v1.y; return dx*dx + dy*dy; }
+float GetDistance(Vector2 v1, Vector2 v2) { return sqrtf(GetDistanceSqr(v1, v2)); }
+
+// PCG32. Every game owns its generators so a seed fully determines a run; raylib's
+// global GetRandomValue is left to frontend-only cosmetics (screen shake, menu shapes).
+struct Rng {
+    uint64_t state = 0;
+    Rng(uint64_t seed = 1) { state = seed + 0x853C49E6748FEA9BULL; Next(); }
+    uint32_t Next() {
+        uint64_t old = state; state = old * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint32_t xorshifted = (uint32_t)(((old >> 18u) ^ old) >> 27u), rot = (uint32_t)(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+    // Inclusive on both ends, like GetRandomValue.
+    int Range(int min, int max) { if (max < min) std::swap(min, max); return min + (int)(Next() % (uint32_t)(max - min + 1)); }
+};
 
-bool DrawCustomButton(Rectangle bounds, const char* text, Color baseCol, int fontSize = 24) {
-    Vector2 mouse = GetMousePosition();
+// Draw-only; clicks are hit-tested against the same rectangle in the update phase.
+void DrawCustomButton(Rectangle bounds, const char* text, Color baseCol, Vector2 mouse, int fontSize = 24) {
     bool hovering = CheckCollisionPointRec(mouse, bounds);
     
     DrawRectangleRec(bounds, hovering ? ColorAlpha(baseCol, 0.35f) : ColorAlpha(V_DARKGRAY, 0.6f));
     DrawRectangleLinesEx(bounds, 2, hovering ? baseCol : ColorAlpha(V_WHITE, 0.2f));
     
-    int textWidth = MeasureText(text, fontSize);
-    DrawText(text, bounds.x + (bounds.width/2 - textWidth/2), bounds.y + (bounds.height/2 - fontSize/2), fontSize, hovering ? V_WHITE : ColorAlpha(V_WHITE, 0.7f));
-    return hovering && IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+    int textWidth = MeasureTextCached(text, fontSize);
+    DrawTextCached(text, bounds.x + (bounds.width/2 - textWidth/2), bounds.y + (bounds.height/2 - fontSize/2), fontSize, hovering ? V_WHITE : ColorAlpha(V_WHITE, 0.7f));
 }
 
-void DrawHealthBody(Vector2 pos, int sides, float radius, float healthRatio, Color col) {
-    if (healthRatio > 0.5f) DrawPoly(pos, sides, radius, 0, ColorAlpha(col, healthRatio * 0.4f));
-    DrawPolyLinesEx(pos, sides, radius, 0, 2.5f, ColorAlpha(col, healthRatio + 0.2f));
-}
+const Rectangle BTN_BOOT = { SCREEN_WIDTH/2 - 150, 360, 300, 65 }, BTN_LEADERBOARD = { SCREEN_WIDTH/2 - 150, 440, 300, 65 }, BTN_GUIDE = { SCREEN_WIDTH/2 - 150, 520, 300, 65 };
+const Rectangle BTN_RESUME = { SCREEN_WIDTH/2 - 120, 350, 240, 60 }, BTN_QUIT = { SCREEN_WIDTH/2 - 120, 420, 240, 60 }, BTN_RETURN = { SCREEN_WIDTH/2 - 100, 620, 200, 50 };
+const Rectangle BTN_ARMORY = { SCREEN_WIDTH - 550, SCREEN_HEIGHT - 72, 250, 60 }, BTN_START_WAVE = { SCREEN_WIDTH - 280, SCREEN_HEIGHT - 72, 250, 60 }, BTN_PULSE = { 25, SCREEN_HEIGHT - 120, 230, 50 };
+const Rectangle BTN_BUY_SLOT = { SCREEN_WIDTH/2 - 200, 180, 400, 65 }, BTN_BUY_PULSE = { SCREEN_WIDTH/2 - 200, 260, 400, 65 }, BTN_BUY_FIRE = { SCREEN_WIDTH/2 - 200, 340, 400, 65 }, BTN_BUY_REPAIR = { SCREEN_WIDTH/2 - 200, 420, 400, 65 };
+const Rectangle BTN_SAVE_SCORE = { SCREEN_WIDTH/2 - 40, 410, 200, 50 }, BTN_REBOOT = { SCREEN_WIDTH/2 - 150, 600, 300, 65 };
 
-void SpawnParticleBurst(std::vector<Particle>& particles, Vector2 pos, Color col, int count, float speed) {
-    for (int i = 0; i < count; i++) {
-        float angle = (float)GetRandomValue(0, 360) * DEG2RAD;
-        float s = (float)GetRandomValue(50, 200) * 0.01f * speed;
-        particles.push_back({ pos, {cosf(angle) * s, sinf(angle) * s}, col, 1.0f, 1.0f, false });
+
+// --- JOB SYSTEM ---
+// Fixed pool of worker threads, each with its own fixed-capacity ring of jobs (a deque would
+// allocate a node every few dozen jobs). ParallelFor deals chunks of a range round-robin
+// across the rings (slot 0 belongs to the calling thread, which helps until the range is
+// done) and runs a chunk inline if its ring is full; an idle thread pops its own back and
+// steals other fronts.
+// Jobs must only write disjoint data, so results never depend on which thread ran what.
+// A ParallelFor issued from inside a job runs inline, so whole games can be jobs too.
+struct JobSystem {
+    struct Job { void (*fn)(void*, int, int); void* ctx; int begin, end; std::atomic<int>* pending; };
+    static const uint32_t QUEUE_CAPACITY = 1024; // Power of two; a --balance fan-out is the largest
+    struct Queue {
+        std::mutex lock;
+        std::array<Job, QUEUE_CAPACITY> jobs;
+        uint32_t head = 0, tail = 0; // Front and one past the back; wrap through the mask
+        bool Push(const Job& job) { if (tail - head == QUEUE_CAPACITY) return false; jobs[tail++ & (QUEUE_CAPACITY - 1)] = job; return true; }
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::mutex sleepLock; std::condition_variable wake;
+    std::atomic<int> queued{ 0 };
+    std::atomic<bool> stopping{ false };
+    static inline thread_local bool insideJob = false;
+
+    ~JobSystem() { Stop(); }
+    int ThreadCount() const { return (int)workers.size() + 1; }
+
+    void Start(int workerCount) {
+        Stop(); stopping = false;
+        queues.clear();
+        for (int q = 0; q <= workerCount; q++) queues.push_back(std::make_unique<Queue>());
+        for (int w = 1; w <= workerCount; w++) workers.emplace_back([this, w] { WorkerLoop(w); });
     }
-}
 
-// --- MAIN APPLICATION ---
-int main() {
-    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Vector-Defense | Prime Edition");
-    InitAudioDevice();
-    SetTargetFPS(60);
+    void Stop() {
+        { std::lock_guard<std::mutex> lk(sleepLock); stopping = true; }
+        wake.notify_all();
+        for (auto& t : workers) t.join();
+        workers.clear();
+    }
 
-    // --- ASSET LOADING (Looking in sounds/ folder) ---
-    sndBlip = LoadSound("sounds/blip.wav");
-    sndBoom = LoadSound("sounds/boom.wav");
-    sndShoot = LoadSound("sounds/shoot.wav");
-    LoadHighScores();
+    bool Pop(int self, Job& job) {
+        for (size_t k = 0; k < queues.size(); k++) {
+            Queue& q = *queues[(self + k) % queues.size()];
+            std::lock_guard<std::mutex> lk(q.lock);
+            if (q.head == q.tail) continue;
+            job = (k == 0) ? q.jobs[--q.tail & (QUEUE_CAPACITY - 1)] : q.jobs[q.head++ & (QUEUE_CAPACITY - 1)];
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
 
-    Shader bloom = LoadShaderFromMemory(0, bloomShaderCode);
-    RenderTexture2D target = LoadRenderTexture(SCREEN_WIDTH, SCREEN_HEIGHT);
+    static void Run(const Job& job) {
+        bool outer = insideJob; insideJob = true;
+        job.fn(job.ctx, job.begin, job.end);
+        insideJob = outer;
+        job.pending->fetch_sub(1, std::memory_order_release);
+    }
 
-    GameScreen currentScreen = START_MENU;
-    Vector2 corePos = { (float)SCREEN_WIDTH / 2, (float)SCREEN_HEIGHT / 2 };
-    
-    int coreHealth = 20, maxCoreHealth = 20, score = 0, currency = 0, currentWave = 0, enemiesToSpawn = 0;
-    float spawnTimer = 0.0f;
-    bool waveActive = false, bossInQueue = false; 
-    
-    int maxTowers = 3;
-    float towerFireRate = 0.8f, towerRange = 230.0f; 
-    int pulseWaveCharges = 0;
-    TowerType currentSelection = TWR_STANDARD;
-    bool cryoUnlocked = false, teslaUnlocked = false, pendingCryoNotify = false, pendingTeslaNotify = false;
+    void WorkerLoop(int self) {
+        Job job;
+        while (!stopping) {
+            if (Pop(self, job)) { Run(job); continue; }
+            std::unique_lock<std::mutex> lk(sleepLock);
+            wake.wait(lk, [this] { return stopping || queued.load(std::memory_order_relaxed) > 0; });
+        }
+    }
 
-    char playerName[13] = "\0";
-    int letterCount = 0;
-    bool scoreSaved = false;
+    // Calls fn(begin, end) over [0, count) in chunks of `grain`; returns once all chunks ran.
+    template <typename Fn>
+    void ParallelFor(int count, int grain, Fn&& fn) {
+        if (count <= 0) return;
+        if (workers.empty() || count <= grain || insideJob) { fn(0, count); return; }
+        using F = std::remove_reference_t<Fn>;
+        std::atomic<int> pending{ 0 };
+        size_t q = 0;
+        for (int b = 0; b < count; b += grain, q++) {
+            Job job = { [](void* ctx, int b0, int e0) { (*(F*)ctx)(b0, e0); }, (void*)&fn, b, std::min(b + grain, count), &pending };
+            pending.fetch_add(1, std::memory_order_relaxed);
+            Queue& target = *queues[q % queues.size()];
+            bool pushed;
+            { std::lock_guard<std::mutex> lk(target.lock); pushed = target.Push(job); }
+            if (pushed) queued.fetch_add(1, std::memory_order_relaxed); else Run(job);
+        }
+        { std::lock_guard<std::mutex> lk(sleepLock); }
+        wake.notify_all();
+        Job job;
+        while (pending.load(std::memory_order_acquire) > 0) { if (Pop(0, job)) Run(job); else std::this_thread::yield(); }
+    }
+};
 
-    float waveIntroTimer = 0.0f, empTimer = 0.0f, overdriveTimer = 0.0f, empWaveRadius = 0.0f, pulseVisualRadius = 0.0f, shakeIntensity = 0.0f, damageFlashTimer = 0.0f;
+JobSystem jobs;
 
-    Camera2D camera = { 0 }; camera.zoom = 1.0f;
-    std::vector<Enemy> enemies;
-    std::vector<Tower> towers;
-    std::vector<Laser> lasers;
-    std::vector<PowerUp> powerups;
-    std::vector<Particle> particles;
-    std::vector<MenuShape> menuShapes;
-    std::vector<Notification> notifications;
+// Single-producer/single-consumer ring. N must be a power of two; Push fails when full.
+template <typename T, uint32_t N>
+struct SpscQueue {
+    static_assert((N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+    T items[N];
+    alignas(64) std::atomic<uint32_t> head{ 0 }; // Next slot to pop, owned by the consumer
+    alignas(64) std::atomic<uint32_t> tail{ 0 }; // Next slot to push, owned by the producer
 
-    for (int i = 0; i < 20; i++) {
-        menuShapes.push_back({{(float)GetRandomValue(0, SCREEN_WIDTH), (float)GetRandomValue(0, SCREEN_HEIGHT)}, (float)GetRandomValue(40, 100)/100.0f, (float)GetRandomValue(0, 360), (float)GetRandomValue(-20, 20)/10.0f, GetRandomValue(3, 8), (float)GetRandomValue(30, 120)});
+    bool Push(const T& v) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == N) return false;
+        items[t & (N - 1)] = v; tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+    bool Pop(T& v) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        v = items[h & (N - 1)]; head.store(h + 1, std::memory_order_release);
+        return true;
     }
+    bool Empty() const { return head.load(std::memory_order_relaxed) == tail.load(std::memory_order_acquire); } // Consumer side
+};
 
-    // --- GAME LOOP ---
-    while (!WindowShouldClose()) {
-        float dt = GetFrameTime();
-        Vector2 mousePos = GetMousePosition();
+// Lock-free triple buffer: the writer fills Back() and publishes it, the reader takes the
+// newest published buffer in Front(). Neither side ever waits; stale frames are dropped.
+template <typename T>
+struct TripleBuffer {
+    static const int FRESH = 4;
+    T buffers[3];
+    std::atomic<int> middle{ 1 };
+    int back = 0, front = 2;
 
-        if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_P)) {
-            if (currentScreen == GAMEPLAY) currentScreen = PAUSED;
-            else if (currentScreen == PAUSED) currentScreen = GAMEPLAY;
+    T& Back() { return buffers[back]; }
+    void Publish() { back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & 3; }
+    const T& Front() {
+        if (middle.load(std::memory_order_relaxed) & FRESH) front = middle.exchange(front, std::memory_order_acq_rel) & 3;
+        return buffers[front];
+    }
+};
+
+const int STEER_CHUNK = 2048; // Multiple of 8, see SteerEnemyRange
+const int TOWER_CHUNK = 4;
+
+// --- AUDIO VOICES ---
+// Each sound gets a small pool of aliases (shared sample data, independent playback), which
+// caps how many copies overlap. Requests are coalesced per frame by the caller and handed
+// to an audio thread over an SPSC queue, so the game loop never waits on the mixer lock.
+// Samples are compiled in (embedded_sounds.h), so no file lookup or WAV decode at startup.
+enum SoundId { SND_BLIP, SND_BOOM, SND_SHOOT, SND_COUNT };
+struct EmbeddedPcm { const int16_t* samples; unsigned int frames; };
+const EmbeddedPcm SOUND_PCM[SND_COUNT] = {
+    { embeddedBlipPcm, (unsigned int)(sizeof(embeddedBlipPcm) / sizeof(int16_t)) },
+    { embeddedBoomPcm, (unsigned int)(sizeof(embeddedBoomPcm) / sizeof(int16_t)) },
+    { embeddedShootPcm, (unsigned int)(sizeof(embeddedShootPcm) / sizeof(int16_t)) },
+};
+const int SOUND_VOICES[SND_COUNT] = { 2, 3, 4 };
+const int MAX_SOUND_VOICES = 4;
+
+struct AudioCommand { uint8_t sound; float volume; };
+
+struct AudioVoices {
+    Sound source[SND_COUNT] = {};
+    Sound voices[SND_COUNT][MAX_SOUND_VOICES] = {};
+    int voiceCount[SND_COUNT] = {}, nextSteal[SND_COUNT] = {};
+    SpscQueue<AudioCommand, 64> commands;
+    std::atomic<bool> stopping{ false };
+    std::thread thread;
+
+    void Load() {
+        for (int s = 0; s < SND_COUNT; s++) {
+            Wave wave = { SOUND_PCM[s].frames, EMBEDDED_SOUND_RATE, 16, 1, (void*)SOUND_PCM[s].samples };
+            source[s] = LoadSoundFromWave(wave); // Copies the samples; the arrays stay read-only
+            if (!IsSoundReady(source[s])) continue; // No audio device: the sound stays silent
+            for (int v = 0; v < SOUND_VOICES[s]; v++) voices[s][voiceCount[s]++] = LoadSoundAlias(source[s]);
         }
+        stopping = false;
+        thread = std::thread([this] { Loop(); });
+    }
 
-        bool mouseInHeader = mousePos.y < UI_HEADER_HEIGHT;
-        bool mouseInFooter = (!waveActive && enemies.empty()) && (mousePos.y > SCREEN_HEIGHT - UI_FOOTER_HEIGHT);
-        Rectangle pulseRect = { 25, (float)SCREEN_HEIGHT - 120, 230, 50 };
-        bool overPulseButton = (waveActive && pulseWaveCharges > 0 && CheckCollisionPointRec(mousePos, pulseRect));
-        bool mouseOnUi = mouseInHeader || mouseInFooter || overPulseButton || (currentScreen == UPGRADE_MENU) || (currentScreen == GAME_OVER) || (currentScreen == PAUSED);
+    void Unload() {
+        stopping = true;
+        if (thread.joinable()) thread.join();
+        for (int s = 0; s < SND_COUNT; s++) {
+            for (int v = 0; v < voiceCount[s]; v++) UnloadSoundAlias(voices[s][v]);
+            UnloadSound(source[s]); voiceCount[s] = 0;
+        }
+    }
 
-        if (shakeIntensity > 0) {
-            camera.offset.x = GetRandomValue(-shakeIntensity, shakeIntensity);
-            camera.offset.y = GetRandomValue(-shakeIntensity, shakeIntensity);
-            shakeIntensity -= 15.0f * dt;
-        } else { camera.offset = {0,0}; }
+    // `count` same-frame requests merge into one trigger, a little louder for bigger volleys.
+    void Play(SoundId sound, int count = 1) {
+        if (count <= 0) return;
+        commands.Push({ (uint8_t)sound, std::min(1.0f, 0.6f + 0.15f * sqrtf((float)(count - 1))) });
+    }
 
-        if (damageFlashTimer > 0) damageFlashTimer -= dt;
+    // Prefers an idle voice; with all of them busy, restarts the oldest one instead.
+    void Trigger(const AudioCommand& cmd) {
+        int s = cmd.sound, n = voiceCount[s];
+        if (n == 0) return;
+        int pick = -1;
+        for (int v = 0; v < n && pick < 0; v++) if (!IsSoundPlaying(voices[s][v])) pick = v;
+        if (pick < 0) { pick = nextSteal[s]; nextSteal[s] = (nextSteal[s] + 1) % n; }
+        SetSoundVolume(voices[s][pick], cmd.volume);
+        PlaySound(voices[s][pick]);
+    }
 
-        // --- SYSTEM UPDATE ---
-        switch (currentScreen) {
-            case START_MENU: {
-                for (auto &ms : menuShapes) {
-                    ms.pos.y -= ms.speed; ms.rotation += ms.rotSpeed;
-                    if (ms.pos.y < -ms.size) { ms.pos.y = SCREEN_HEIGHT + ms.size; ms.pos.x = (float)GetRandomValue(0, SCREEN_WIDTH); }
-                }
-                if (IsKeyPressed(KEY_ENTER)) { PlaySound(sndBlip); currentScreen = GAMEPLAY; }
-            } break;
+    void Loop() {
+        AudioCommand cmd;
+        while (!stopping) {
+            while (commands.Pop(cmd)) Trigger(cmd);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
 
-            case GUIDE: { if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_BACKSPACE)) currentScreen = START_MENU; } break;
-            case LEADERBOARD: { if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_BACKSPACE)) currentScreen = START_MENU; } break;
-            case PAUSED: break;
+// --- ENEMY STORE ---
+// Structure-of-arrays enemy container. Hot loops touch only the columns they need
+// (movement reads pos/speed/slowTimer). Removal is deferred: MarkRemove() flags an
+// entry and Compact() swap-pops all flagged entries in one O(removed) pass, so dense
+// indices are only stable within a tick. EnemyHandle survives compaction.
+struct EnemyHandle { uint32_t slot; uint32_t generation; };
 
-            case UPGRADE_MENU: {
-                int slotCost = 400 + (maxTowers - 3) * 350;
-                int fireCost = 600 + (int)((0.8f - towerFireRate) * 10000);
+// Columns are reserved up front, so spawning (and copying the store into snapshots) never
+// reallocates below this many live enemies.
+const int ENEMY_RESERVE = 8192;
 
-                if (CheckCollisionPointRec(mousePos, { SCREEN_WIDTH/2 - 200, 180, 400, 65 }) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                    if (currency >= slotCost) { currency -= slotCost; maxTowers++; PlaySound(sndBlip);
-                        if (maxTowers == 5 && !cryoUnlocked) { cryoUnlocked = true; pendingCryoNotify = true; }
-                        if (maxTowers == 7 && !teslaUnlocked) { teslaUnlocked = true; pendingTeslaNotify = true; }
-                    }
-                }
-                if (CheckCollisionPointRec(mousePos, { SCREEN_WIDTH/2 - 200, 260, 400, 65 }) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                    if (currency >= 300) { currency -= 300; pulseWaveCharges++; PlaySound(sndBlip); }
-                }
-                if (CheckCollisionPointRec(mousePos, { SCREEN_WIDTH/2 - 200, 340, 400, 65 }) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                    if (currency >= fireCost) { currency -= fireCost; towerFireRate *= 0.85f; PlaySound(sndBlip); }
-                }
-                if (CheckCollisionPointRec(mousePos, { SCREEN_WIDTH/2 - 200, 420, 400, 65 }) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                    if (currency >= 450 && coreHealth < maxCoreHealth) { currency -= 450; coreHealth = std::min(coreHealth + 6, maxCoreHealth); PlaySound(sndBlip); }
-                }
+struct EnemyStore {
+    std::vector<float> posX, posY, speed, health, maxHealth, radius, slowTimer;
+    std::vector<float> prevX, prevY; // Position before the last steering pass, for render interpolation
+    std::vector<int> sides;
+    std::vector<unsigned char> active, removed;
 
-                if (IsKeyPressed(KEY_U) || IsKeyPressed(KEY_ENTER)) {
-                    currentScreen = GAMEPLAY;
-                    if (pendingCryoNotify) {
-                        notifications.push_back({"CRYO-TECH UNLOCKED!", 5.0f, V_SKYBLUE});
-                        notifications.push_back({"PRESS [2] TO SELECT", 5.0f, V_WHITE});
-                        pendingCryoNotify = false;
-                    }
-                    if (pendingTeslaNotify) {
-                        notifications.push_back({"TESLA-TECH UNLOCKED!", 5.0f, V_GOLD});
-                        notifications.push_back({"PRESS [3] TO SELECT", 5.0f, V_WHITE});
-                        pendingTeslaNotify = false;
-                    }
-                }
-            } break;
+    std::vector<uint32_t> slotOf;    // Dense index -> handle slot
+    std::vector<uint32_t> indexOf;   // Handle slot -> dense index
+    std::vector<uint32_t> slotGen;   // Bumped every time a slot is freed
+    std::vector<uint32_t> freeSlots;
+    int removedCount = 0;
 
-            case GAMEPLAY: {
-                if (waveIntroTimer > 0) waveIntroTimer -= dt;
-                if (IsKeyPressed(KEY_ONE)) currentSelection = TWR_STANDARD;
-                if (IsKeyPressed(KEY_TWO) && cryoUnlocked) currentSelection = TWR_CRYO;
-                if (IsKeyPressed(KEY_THREE) && teslaUnlocked) currentSelection = TWR_TESLA;
-
-                if (waveActive && pulseWaveCharges > 0 && CheckCollisionPointRec(mousePos, pulseRect) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                    pulseWaveCharges--; shakeIntensity = 35.0f; pulseVisualRadius = 10.0f; PlaySound(sndBoom);
-                    notifications.push_back({"PULSE DISCHARGED", 2.5f, V_RED});
-                    for (auto &e : enemies) {
-                        float dist = GetDistance(corePos, e.position);
-                        if (dist < 450.0f) { e.health -= (500.0f - dist) / 5.0f; if(e.health <= 0) e.active = false; }
-                    }
-                }
+    EnemyStore() {
+        for (auto* c : { &posX, &posY, &speed, &health, &maxHealth, &radius, &slowTimer, &prevX, &prevY }) c->reserve(ENEMY_RESERVE);
+        sides.reserve(ENEMY_RESERVE); active.reserve(ENEMY_RESERVE); removed.reserve(ENEMY_RESERVE);
+        for (auto* c : { &slotOf, &indexOf, &slotGen, &freeSlots }) c->reserve(ENEMY_RESERVE);
+    }
 
-                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && !mouseOnUi) {
-                    bool pickedUp = false;
-                    for(auto &p : powerups) {
-                        if(p.active && GetDistance(mousePos, p.position) < 45) {
-                            if(p.type == PWR_EMP) { empTimer = 4.5f; empWaveRadius = 10.0f; notifications.push_back({"SYSTEM EMP ACTIVATED", 2.0f, V_PURPLE}); }
-                            else if(p.type == PWR_OVERDRIVE) { overdriveTimer = 7.0f; notifications.push_back({"LASER OVERDRIVE ONLINE", 2.0f, V_GOLD}); }
-                            else if(p.type == PWR_HEAL) { 
-                                coreHealth = std::min(coreHealth + 3, maxCoreHealth); 
-                                notifications.push_back({"INTEGRITY RESTORED", 2.0f, V_CYAN}); 
-                                for(int i=0; i<80; i++) particles.push_back({{p.position.x + (float)GetRandomValue(-20,20), p.position.y + (float)GetRandomValue(-20,20)}, {0,0}, V_CYAN, 1.5f, 1.5f, true});
-                            }
-                            PlaySound(sndBlip); p.active = false; pickedUp = true; break;
-                        }
-                    }
-                    if (!pickedUp && towers.size() < (size_t)maxTowers && GetDistance(mousePos, corePos) > EXCLUSION_RADIUS) {
-                        PlaySound(sndBlip); towers.push_back({ mousePos, 0.0f, currentSelection });
-                    }
-                }
+    int Size() const { return (int)posX.size(); }
+    bool Empty() const { return posX.empty(); }
+    Vector2 Position(int i) const { return { posX[i], posY[i] }; }
+    Vector2 Interpolated(int i, float alpha) const { return { prevX[i] + (posX[i] - prevX[i]) * alpha, prevY[i] + (posY[i] - prevY[i]) * alpha }; }
 
-                if (IsKeyPressed(KEY_SPACE) && pulseWaveCharges > 0 && waveActive) {
-                    pulseWaveCharges--; shakeIntensity = 35.0f; pulseVisualRadius = 10.0f; PlaySound(sndBoom);
-                    notifications.push_back({"PULSE DISCHARGED", 2.5f, V_RED});
-                    for (auto &e : enemies) {
-                        float dist = GetDistance(corePos, e.position);
-                        if (dist < 450.0f) { e.health -= (500.0f - dist) / 5.0f; if(e.health <= 0) e.active = false; }
-                    }
-                }
+    EnemyHandle Add(const Enemy& e) {
+        uint32_t slot;
+        if (!freeSlots.empty()) { slot = freeSlots.back(); freeSlots.pop_back(); }
+        else { slot = (uint32_t)indexOf.size(); indexOf.push_back(0); slotGen.push_back(0); }
+        indexOf[slot] = (uint32_t)posX.size(); slotOf.push_back(slot);
+        posX.push_back(e.position.x); posY.push_back(e.position.y); prevX.push_back(e.position.x); prevY.push_back(e.position.y); speed.push_back(e.speed); health.push_back(e.health); maxHealth.push_back(e.maxHealth);
+        radius.push_back(e.radius); slowTimer.push_back(e.slowTimer); sides.push_back(e.sides); active.push_back(e.active); removed.push_back(0);
+        return { slot, slotGen[slot] };
+    }
 
-                if (waveActive && waveIntroTimer <= 0) {
-                    spawnTimer += dt;
-                    if (enemiesToSpawn > 0 && spawnTimer > std::max(0.15f, 1.25f - (currentWave * 0.06f))) {
-                        float angle = (float)GetRandomValue(0, 360) * DEG2RAD;
-                        Enemy e; e.position = { corePos.x + cosf(angle) * 850.0f, corePos.y + sinf(angle) * 850.0f };
-                        e.radius = 22.0f; e.sides = GetRandomValue(3, std::min(10, 3 + (currentWave / 2)));
-                        e.speed = (180.0f - ((float)e.sides * 8.0f)) * std::min(1.6f, 1.0f + (currentWave * 0.035f)); 
-                        e.maxHealth = (float)e.sides * 1.2f; e.health = e.maxHealth; e.active = true; e.slowTimer = 0; enemies.push_back(e); enemiesToSpawn--; spawnTimer = 0;
-                    } else if (enemiesToSpawn <= 0 && bossInQueue && spawnTimer > 1.8f) {
-                        float angle = (float)GetRandomValue(0, 360) * DEG2RAD;
-                        Enemy boss; boss.position = { corePos.x+cosf(angle)*850.0f, corePos.y+sinf(angle)*850.0f };
-                        boss.sides = 24; boss.radius = 90.0f; boss.maxHealth = 180.0f + ((float)currentWave * 25.0f); boss.health = boss.maxHealth; boss.speed = 25.0f; boss.active = true; boss.slowTimer = 0;
-                        enemies.push_back(boss); bossInQueue = false; spawnTimer = 0; notifications.push_back({"BOSS DETECTED", 3.0f, V_RED});
-                    }
-                }
+    Enemy Get(int i) const { return { Position(i), speed[i], sides[i], health[i], maxHealth[i], active[i] != 0, radius[i], slowTimer[i] }; }
+    EnemyHandle HandleAt(int i) const { return { slotOf[i], slotGen[slotOf[i]] }; }
+    // Dense index for a handle, or -1 once the enemy has been compacted away.
+    int Resolve(EnemyHandle h) const { return (h.slot < slotGen.size() && slotGen[h.slot] == h.generation) ? (int)indexOf[h.slot] : -1; }
 
-                for (auto it = enemies.begin(); it != enemies.end();) {
-                    if (empTimer <= 0) { 
-                        float moveSpeed = it->speed; if (it->slowTimer > 0) { moveSpeed *= 0.4f; it->slowTimer -= dt; }
-                        float angle = atan2f(corePos.y - it->position.y, corePos.x - it->position.x);
-                        it->position.x += cosf(angle) * moveSpeed * dt; it->position.y += sinf(angle) * moveSpeed * dt;
-                    }
-                    if (GetDistance(it->position, corePos) < CORE_RADIUS) {
-                        if (it->sides == 24) { coreHealth -= 5; shakeIntensity = 45.0f; } else { coreHealth--; shakeIntensity = 18.0f; }
-                        damageFlashTimer = 0.18f; it = enemies.erase(it);
-                    } else if (!it->active) {
-                        currency += (it->sides * 14) + 20; score += (int)(it->maxHealth * 100);
-                        SpawnParticleBurst(particles, it->position, V_WHITE, 12, 2.0f);
-                        if (it->sides >= 6) { for(int s=0; s<2; s++) enemies.push_back({it->position, 180.0f, 3, 5.0f, 5.0f, true, 16.0f, 0}); }
-                        if(GetRandomValue(1, 100) <= 20) powerups.push_back({it->position, (PowerType)GetRandomValue(0, 2), 10.0f, true, 0.0f});
-                        it = enemies.erase(it);
-                    } else ++it;
-                }
+    void MarkRemove(int i) { if (!removed[i]) { removed[i] = 1; removedCount++; } }
 
-                if (waveActive && enemiesToSpawn <= 0 && !bossInQueue && enemies.empty()) { waveActive = false; towers.clear(); notifications.push_back({"WAVE CLEAR", 2.0f, V_SKYBLUE}); }
-
-                for (auto &t : towers) {
-                    t.shootTimer += dt;
-                    if (overdriveTimer > 0 && GetRandomValue(0, 4) == 0) particles.push_back({{t.position.x + (float)GetRandomValue(-15,15), t.position.y + (float)GetRandomValue(-15,15)}, {0, -120}, V_GOLD, 0.4f, 0.4f, false});
-                    
-                    float rate = (overdriveTimer > 0) ? 0.05f : towerFireRate;
-                    if (t.type == TWR_CRYO || t.type == TWR_TESLA) rate *= 1.5f;
-                    
-                    if (t.shootTimer >= rate) {
-                        Enemy* target = nullptr; float minDist = towerRange;
-                        for (auto& e : enemies) { float d = GetDistance(t.position, e.position); if (d < minDist) { minDist = d; target = &e; } }
-                        if (target) {
-                            PlaySound(sndShoot); shakeIntensity += 1.5f; 
-                            if (t.type == TWR_CRYO) { target->health -= 0.5f; target->slowTimer = 1.5f; lasers.push_back({ t.position, target->position, 0.07f, V_SKYBLUE }); }
-                            else if (t.type == TWR_TESLA) { 
-                                target->health -= 0.8f; lasers.push_back({ t.position, target->position, 0.07f, V_GOLD });
-                                Enemy* sec = nullptr; float sDist = 200.0f;
-                                for (auto& e2 : enemies) { if (&e2 == target) continue; float d2 = GetDistance(target->position, e2.position); if (d2 < sDist) { sDist = d2; sec = &e2; } }
-                                if (sec) { sec->health -= 0.6f; if (sec->health <= 0) sec->active = false; lasers.push_back({ target->position, sec->position, 0.12f, V_GOLD }); }
-                            } else { target->health -= 1.0f; lasers.push_back({ t.position, target->position, 0.07f, V_WHITE }); }
-                            if (target->health <= 0) target->active = false;
-                            t.shootTimer = 0;
-                        }
-                    }
-                }
+    void Compact() {
+        for (int i = 0; removedCount > 0 && i < Size();) {
+            if (!removed[i]) { i++; continue; }
+            uint32_t slot = slotOf[i]; slotGen[slot]++; freeSlots.push_back(slot);
+            int last = Size() - 1;
+            if (i != last) {
+                posX[i] = posX[last]; posY[i] = posY[last]; speed[i] = speed[last]; health[i] = health[last]; maxHealth[i] = maxHealth[last];
+                radius[i] = radius[last]; slowTimer[i] = slowTimer[last]; sides[i] = sides[last]; active[i] = active[last]; removed[i] = removed[last];
+                prevX[i] = prevX[last]; prevY[i] = prevY[last];
+                slotOf[i] = slotOf[last]; indexOf[slotOf[i]] = (uint32_t)i;
+            }
+            posX.pop_back(); posY.pop_back(); speed.pop_back(); health.pop_back(); maxHealth.pop_back();
+            radius.pop_back(); slowTimer.pop_back(); sides.pop_back(); active.pop_back(); removed.pop_back(); slotOf.pop_back();
+            prevX.pop_back(); prevY.pop_back();
+            removedCount--;
+        }
+    }
 
-                for (auto it = lasers.begin(); it != lasers.end();) { it->lifetime -= dt; if (it->lifetime <= 0) it = lasers.erase(it); else ++it; }
-                for (auto it = powerups.begin(); it != powerups.end();) { 
-                    if (waveActive) { it->timer -= dt; }
-                    it->rotation += 120.0f * dt; 
-                    if (it->timer <= 0 || !it->active) { it = powerups.erase(it); } else { ++it; }
-                }
-                for (auto it = particles.begin(); it != particles.end();) {
-                    it->life -= dt;
-                    if (it->seekingCore) { float a = atan2f(corePos.y - it->pos.y, corePos.x - it->pos.x); it->pos.x += cosf(a) * 600.0f * dt; it->pos.y += sinf(a) * 600.0f * dt; if (GetDistance(it->pos, corePos) < 15.0f) it->life = 0; }
-                    else { it->pos.x += it->vel.x * dt; it->pos.y += it->vel.y * dt; }
-                    if (it->life <= 0) it = particles.erase(it); else ++it;
-                }
-                for (auto it = notifications.begin(); it != notifications.end();) { it->timer -= dt; if (it->timer <= 0) it = notifications.erase(it); else ++it; }
-                if (empWaveRadius > 0) { empWaveRadius += 1600.0f * dt; if (empWaveRadius > 2500.0f) { empWaveRadius = 0; } }
-                if (pulseVisualRadius > 0) { pulseVisualRadius += 2200.0f * dt; if (pulseVisualRadius > 1500.0f) { pulseVisualRadius = 0; } }
-                if (empTimer > 0) empTimer -= dt;
-                if (overdriveTimer > 0) overdriveTimer -= dt;
-
-                if (coreHealth <= 0) { currentScreen = GAME_OVER; scoreSaved = false; playerName[0] = '\0'; letterCount = 0; }
-                if (IsKeyPressed(KEY_U) && !waveActive) { currentScreen = UPGRADE_MENU; }
-            } break;
+    // Drops every enemy and handle; capacity is kept.
+    void Clear() {
+        for (auto* c : { &posX, &posY, &speed, &health, &maxHealth, &radius, &slowTimer, &prevX, &prevY }) c->clear();
+        sides.clear(); active.clear(); removed.clear();
+        for (auto* c : { &slotOf, &indexOf, &slotGen, &freeSlots }) c->clear();
+        removedCount = 0;
+    }
+};
 
-            case GAME_OVER: {
-                int key = GetCharPressed();
-                while (key > 0) { if ((key >= 32) && (key <= 125) && (letterCount < 12)) { playerName[letterCount] = (char)key; playerName[letterCount+1] = '\0'; letterCount++; } key = GetCharPressed(); }
-                if (IsKeyPressed(KEY_BACKSPACE)) { letterCount--; if (letterCount < 0) { letterCount = 0; } playerName[letterCount] = '\0'; }
-            } break;
+// --- ENEMY STEERING KERNEL ---
+// Moves every enemy straight at the core using normalized direction vectors, never
+// atan2/cos/sin. Runs 8 lanes (AVX), 4 lanes (SSE2/NEON) or scalar. Slow and EMP are
+// applied as multipliers: `moveScale` is 0 under EMP (no movement, slow timers frozen).
+const float CRYO_SLOW_FACTOR = 0.4f;
+
+// Steers enemies [begin, end). Disjoint ranges may run concurrently; starting each range
+// on a multiple of 8 keeps every element on the same SIMD path as a single full pass.
+void SteerEnemyRange(EnemyStore& enemies, int begin, int end, Vector2 core, float dt, float moveScale) {
+    float* px = enemies.posX.data(); float* py = enemies.posY.data(); float* slow = enemies.slowTimer.data(); const float* spd = enemies.speed.data();
+    const int n = end;
+    const float step = dt * moveScale;
+    int i = begin;
+#if defined(VD_SIMD_AVX)
+    {
+        const __m256 vstep = _mm256_set1_ps(step), cx = _mm256_set1_ps(core.x), cy = _mm256_set1_ps(core.y);
+        const __m256 slowF = _mm256_set1_ps(CRYO_SLOW_FACTOR), one = _mm256_set1_ps(1.0f), zero = _mm256_setzero_ps(), eps = _mm256_set1_ps(1e-12f);
+        for (; i + 8 <= n; i += 8) {
+            __m256 x = _mm256_loadu_ps(px + i), y = _mm256_loadu_ps(py + i), st = _mm256_loadu_ps(slow + i);
+            __m256 slowed = _mm256_cmp_ps(st, zero, _CMP_GT_OQ);
+            __m256 dist = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(spd + i), vstep), _mm256_blendv_ps(one, slowF, slowed));
+            __m256 dx = _mm256_sub_ps(cx, x), dy = _mm256_sub_ps(cy, y);
+            __m256 k = _mm256_div_ps(dist, _mm256_sqrt_ps(_mm256_max_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), eps)));
+            _mm256_storeu_ps(px + i, _mm256_add_ps(x, _mm256_mul_ps(dx, k)));
+            _mm256_storeu_ps(py + i, _mm256_add_ps(y, _mm256_mul_ps(dy, k)));
+            _mm256_storeu_ps(slow + i, _mm256_sub_ps(st, _mm256_and_ps(slowed, vstep)));
+        }
+    }
+#endif
+#if defined(VD_SIMD_SSE2)
+    {
+        const __m128 vstep = _mm_set1_ps(step), cx = _mm_set1_ps(core.x), cy = _mm_set1_ps(core.y);
+        const __m128 slowF = _mm_set1_ps(CRYO_SLOW_FACTOR), one = _mm_set1_ps(1.0f), zero = _mm_setzero_ps(), eps = _mm_set1_ps(1e-12f);
+        for (; i + 4 <= n; i += 4) {
+            __m128 x = _mm_loadu_ps(px + i), y = _mm_loadu_ps(py + i), st = _mm_loadu_ps(slow + i);
+            __m128 slowed = _mm_cmpgt_ps(st, zero);
+            __m128 factor = _mm_or_ps(_mm_and_ps(slowed, slowF), _mm_andnot_ps(slowed, one));
+            __m128 dist = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(spd + i), vstep), factor);
+            __m128 dx = _mm_sub_ps(cx, x), dy = _mm_sub_ps(cy, y);
+            __m128 k = _mm_div_ps(dist, _mm_sqrt_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), eps)));
+            _mm_storeu_ps(px + i, _mm_add_ps(x, _mm_mul_ps(dx, k)));
+            _mm_storeu_ps(py + i, _mm_add_ps(y, _mm_mul_ps(dy, k)));
+            _mm_storeu_ps(slow + i, _mm_sub_ps(st, _mm_and_ps(slowed, vstep)));
         }
+    }
+#elif defined(VD_SIMD_NEON)
+    {
+        const float32x4_t vstep = vdupq_n_f32(step), cx = vdupq_n_f32(core.x), cy = vdupq_n_f32(core.y);
+        const float32x4_t slowF = vdupq_n_f32(CRYO_SLOW_FACTOR), one = vdupq_n_f32(1.0f), zero = vdupq_n_f32(0.0f), eps = vdupq_n_f32(1e-12f);
+        for (; i + 4 <= n; i += 4) {
+            float32x4_t x = vld1q_f32(px + i), y = vld1q_f32(py + i), st = vld1q_f32(slow + i);
+            uint32x4_t slowed = vcgtq_f32(st, zero);
+            float32x4_t dist = vmulq_f32(vmulq_f32(vld1q_f32(spd + i), vstep), vbslq_f32(slowed, slowF, one));
+            float32x4_t dx = vsubq_f32(cx, x), dy = vsubq_f32(cy, y);
+            float32x4_t k = vdivq_f32(dist, vsqrtq_f32(vmaxq_f32(vmlaq_f32(vmulq_f32(dx, dx), dy, dy), eps)));
+            vst1q_f32(px + i, vmlaq_f32(x, dx, k));
+            vst1q_f32(py + i, vmlaq_f32(y, dy, k));
+            vst1q_f32(slow + i, vsubq_f32(st, vbslq_f32(slowed, vstep, zero)));
+        }
+    }
+#endif
+    for (; i < n; i++) {
+        float slowed = (slow[i] > 0) ? 1.0f : 0.0f;
+        float dist = spd[i] * step * (1.0f - slowed * (1.0f - CRYO_SLOW_FACTOR));
+        float dx = core.x - px[i], dy = core.y - py[i], k = dist / sqrtf(std::max(dx*dx + dy*dy, 1e-12f));
+        px[i] += dx * k; py[i] += dy * k; slow[i] -= slowed * step;
+    }
+}
 
-        // --- RENDERING PIPELINE ---
-        BeginTextureMode(target);
-            ClearBackground(V_BLACK);
-            BeginMode2D(camera);
-                for(int i = -100; i < SCREEN_WIDTH + 100; i += 64) DrawLine(i, -100, i, SCREEN_HEIGHT + 100, {30, 30, 35, 255});
-                for(int i = -100; i < SCREEN_HEIGHT + 100; i += 64) DrawLine(-100, i, SCREEN_WIDTH + 100, i, {30, 30, 35, 255});
-                
-                if (currentScreen == START_MENU) {
-                    for (const auto& ms : menuShapes) DrawPolyLinesEx(ms.pos, ms.sides, ms.size, ms.rotation, 1.5f, ColorAlpha(V_DARKGRAY, 0.4f));
-                    DrawText("VECTOR DEFENSE", SCREEN_WIDTH/2 - MeasureText("VECTOR DEFENSE", 60)/2, 220, 60, V_CYAN);
-                }
-                if (currentScreen != GUIDE && currentScreen != LEADERBOARD) {
-                    for(const auto& p : particles) DrawCircle((int)p.pos.x, (int)p.pos.y, 2, p.col);
-                    if (empWaveRadius > 0) DrawCircleLines((int)corePos.x, (int)corePos.y, empWaveRadius, ColorAlpha(V_PURPLE, 1.0f - (empWaveRadius/2500.0f)));
-                    if (pulseVisualRadius > 0) DrawRing(corePos, pulseVisualRadius - 15.0f, pulseVisualRadius, 0, 360, 60, ColorAlpha(V_RED, 1.0f - (pulseVisualRadius/1500.0f)));
-                    for (const auto& l : lasers) DrawLineEx(l.start, l.end, 3.0f, l.col);
-                    for(const auto& p : powerups) DrawPolyLinesEx({p.position.x, p.position.y + sinf(GetTime()*5)*5}, 4, 18, p.rotation, 2, (p.type == PWR_EMP ? V_PURPLE : (p.type == PWR_OVERDRIVE ? V_GOLD : V_CYAN)));
-                    if (currentScreen != START_MENU) {
-                        DrawCircleLines((int)corePos.x, (int)corePos.y, EXCLUSION_RADIUS, ColorAlpha(V_RED, 0.3f));
-                        DrawCircleLines((int)corePos.x, (int)corePos.y, CORE_RADIUS, V_CYAN);
-                        DrawCircle((int)corePos.x, (int)corePos.y, 4, V_WHITE);
-                    }
-                    if (currentScreen == GAMEPLAY && !mouseOnUi && towers.size() < (size_t)maxTowers) {
-                        bool valid = GetDistance(mousePos, corePos) > EXCLUSION_RADIUS;
-                        DrawCircleLines((int)mousePos.x, (int)mousePos.y, towerRange, ColorAlpha(valid ? V_WHITE : V_RED, 0.3f));
-                        DrawHealthBody(mousePos, (currentSelection == TWR_STANDARD ? 4 : (currentSelection == TWR_CRYO ? 6 : 8)), 18, 1.0f, ColorAlpha(valid ? (currentSelection == TWR_STANDARD ? V_LIME : (currentSelection == TWR_CRYO ? V_SKYBLUE : V_GOLD)) : V_RED, 0.5f));
-                    }
-                    for (const auto& t : towers) { DrawCircleLines((int)t.position.x, (int)t.position.y, towerRange, ColorAlpha(V_WHITE, 0.1f)); DrawHealthBody(t.position, (t.type == TWR_STANDARD ? 4 : (t.type == TWR_CRYO ? 6 : 8)), 18, 1.0f, (t.type == TWR_STANDARD ? V_LIME : (t.type == TWR_CRYO ? V_SKYBLUE : V_GOLD))); }
-                    for (const auto& e : enemies) DrawHealthBody(e.position, e.sides, e.radius, e.health/e.maxHealth, e.slowTimer > 0 ? V_SKYBLUE : V_RED);
-                }
-            EndMode2D();
-        EndTextureMode();
+void SteerEnemies(EnemyStore& enemies, Vector2 core, float dt, float moveScale) { SteerEnemyRange(enemies, 0, enemies.Size(), core, dt, moveScale); }
 
-        BeginDrawing();
-            ClearBackground(V_BLACK);
-            BeginShaderMode(bloom);
-                DrawTextureRec(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, (float)-target.texture.height }, (Vector2){ 0, 0 }, WHITE);
-            EndShaderMode();
+// Reference implementation the kernel replaced; kept for the --bench-steer comparison.
+void SteerEnemiesLegacy(EnemyStore& enemies, Vector2 core, float dt) {
+    for (int i = 0, n = enemies.Size(); i < n; i++) {
+        float moveSpeed = enemies.speed[i]; if (enemies.slowTimer[i] > 0) { moveSpeed *= 0.4f; enemies.slowTimer[i] -= dt; }
+        float angle = atan2f(core.y - enemies.posY[i], core.x - enemies.posX[i]);
+        enemies.posX[i] += cosf(angle) * moveSpeed * dt; enemies.posY[i] += sinf(angle) * moveSpeed * dt;
+    }
+}
 
-            if (damageFlashTimer > 0) DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_RED, damageFlashTimer * 1.5f));
-            
-            if (currentScreen == START_MENU) {
-                if (DrawCustomButton({ SCREEN_WIDTH/2 - 150, 360, 300, 65 }, "BOOT SEQUENCE", V_LIME)) { currentScreen = GAMEPLAY; waveActive = false; }
-                if (DrawCustomButton({ SCREEN_WIDTH/2 - 150, 440, 300, 65 }, "LEADERBOARD", V_GOLD)) currentScreen = LEADERBOARD;
-                if (DrawCustomButton({ SCREEN_WIDTH/2 - 150, 520, 300, 65 }, "SYSTEM GUIDE", V_WHITE)) currentScreen = GUIDE;
-            } 
-            else if (currentScreen == PAUSED) {
-                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_BLACK, 0.6f));
-                DrawText("SYSTEM PAUSED", SCREEN_WIDTH/2 - MeasureText("SYSTEM PAUSED", 40)/2, 280, 40, V_CYAN);
-                if (DrawCustomButton({ SCREEN_WIDTH/2 - 120, 350, 240, 60 }, "RESUME", V_LIME)) currentScreen = GAMEPLAY;
-                if (DrawCustomButton({ SCREEN_WIDTH/2 - 120, 420, 240, 60 }, "QUIT", V_RED)) currentScreen = START_MENU;
-            }
-            else if (currentScreen == GUIDE || currentScreen == LEADERBOARD) {
-                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_BLACK, 0.95f));
-                if (currentScreen == GUIDE) {
-                    DrawText("SYSTEM OPERATIONAL GUIDE", 60, 60, 35, V_SKYBLUE);
-                    int x1 = 70, x2 = 650, y = 140;
-                    DrawText("THREAT LOG", x1, y, 22, V_RED); DrawText("- Splitting: Complex shapes split into fragments.", x1, y+35, 18, V_WHITE); DrawText("- BOSS LOG: Heavy Primes emerge every 10 waves.", x1, y+60, 18, V_GOLD);
-                    DrawText("DEFENSE LOG", x1, y+130, 22, V_LIME); DrawText("- [1] Standard: Green squares. Normal DPS.", x1, y+165, 18, V_WHITE); DrawText("- [2] Cryo-Slow: Blue hexagons. Freezes threats.", x1, y+190, 18, V_WHITE); DrawText("- [3] Tesla: Gold Octagon. Chain lightning.", x1, y+215, 18, V_WHITE);
-                    DrawText("POWER-UPS", x2, y, 22, V_GOLD); DrawText("- [EMP] Purple: Total movement lock-down.", x2, y+35, 18, V_PURPLE); DrawText("- [OVERDRIVE] Gold: Maximum fire-rate sparks.", x2, y+60, 18, V_GOLD); DrawText("- [NANOBOTS] Cyan: Core absorption repair.", x2, y+85, 18, V_SKYBLUE);
-                    DrawText("SYSTEM CYCLE", x2, y+155, 22, V_CYAN); DrawText("- [SPACE/Button]: Discharge Red Pulse charges.", x2, y+190, 18, V_WHITE); DrawText("- Armory [U]: Upgrade slots and laser fire speed.", x2, y+215, 18, V_WHITE);
-                } else {
-                    DrawText("SYSTEM HALL OF FAME", SCREEN_WIDTH/2 - MeasureText("SYSTEM HALL OF FAME", 35)/2, 60, 35, V_GOLD);
-                    for(int i=0; i<std::min(10, (int)highScores.size()); i++) { DrawText(TextFormat("%d. %s", i+1, highScores[i].name.c_str()), SCREEN_WIDTH/2 - 200, 140 + (i*40), 22, V_WHITE); DrawText(TextFormat("%d", highScores[i].score), SCREEN_WIDTH/2 + 150, 140 + (i*40), 22, V_SKYBLUE); }
-                }
-                if (DrawCustomButton({ SCREEN_WIDTH/2-100, 620, 200, 50 }, "< RETURN", V_WHITE)) currentScreen = START_MENU;
-            } else if (currentScreen == GAMEPLAY || currentScreen == UPGRADE_MENU) {
-                DrawRectangle(0, 0, SCREEN_WIDTH, UI_HEADER_HEIGHT, ColorAlpha(V_BLACK, 0.95f));
-                DrawText(TextFormat("INTEGRITY: %d", coreHealth), 25, 20, 22, coreHealth < 5 ? V_RED : V_WHITE); DrawText(TextFormat("FRAGMENTS: %d", currency), 220, 20, 22, V_GOLD); DrawText(TextFormat("NODES: %d/%d", (int)towers.size(), maxTowers), 420, 20, 22, V_LIME); DrawText(TextFormat("WAVE: %d", currentWave), 580, 20, 22, V_SKYBLUE); DrawText(TextFormat("PULSE: %d", pulseWaveCharges), 720, 20, 22, V_CYAN);
-                std::string mStr = (currentSelection == TWR_CRYO ? "CRYO" : (currentSelection == TWR_TESLA ? "TESLA" : "STANDARD"));
-                Color mCol = (currentSelection == TWR_CRYO ? V_SKYBLUE : (currentSelection == TWR_TESLA ? V_GOLD : V_LIME));
-                DrawText(TextFormat("ACTIVE: %s", mStr.c_str()), SCREEN_WIDTH - 250, 20, 20, mCol);
-                
-                if (waveIntroTimer > 0) {
-                    float alpha = (waveIntroTimer > 1.0f) ? 1.0f : waveIntroTimer;
-                    std::string waveText = "WAVE " + std::to_string(currentWave);
-                    DrawText(waveText.c_str(), SCREEN_WIDTH/2 - MeasureText(waveText.c_str(), 80)/2, SCREEN_HEIGHT/2 - 40, 80, ColorAlpha(V_WHITE, alpha));
-                }
+// --- PARTICLE POOL ---
+// Fixed-capacity SoA particle store. Columns are allocated once at MAX_PARTICLES;
+// spawns past capacity are dropped, dead particles are swap-popped after each update.
+// The integrate-and-age kernel runs 4 lanes at a time (SSE2 or NEON) with free flight
+// and core-seeking blended by mask, so the seekingCore heal stream costs the same.
+const int MAX_PARTICLES = 16384;
+const float PARTICLE_SEEK_SPEED = 600.0f;
+const float PARTICLE_ABSORB_RADIUS = 15.0f;
 
-                if (waveActive) {
-                    if (pulseWaveCharges > 0) {
-                        DrawRectangleRec(pulseRect, CheckCollisionPointRec(mousePos, pulseRect) ? ColorAlpha(V_SKYBLUE, 0.35f) : ColorAlpha(V_DARKGRAY, 0.6f));
-                        DrawRectangleLinesEx(pulseRect, 2, CheckCollisionPointRec(mousePos, pulseRect) ? V_SKYBLUE : ColorAlpha(V_WHITE, 0.2f));
-                        int tw = MeasureText(TextFormat("ACTIVATE PULSE [%d]", pulseWaveCharges), 18);
-                        DrawText(TextFormat("ACTIVATE PULSE [%d]", pulseWaveCharges), pulseRect.x + (pulseRect.width/2 - tw/2), pulseRect.y + (pulseRect.height/2 - 9), 18, V_WHITE);
-                    }
-                    DrawText(TextFormat("THREATS: %d", (int)enemies.size() + enemiesToSpawn + (bossInQueue?1:0)), 25, SCREEN_HEIGHT - 35, 20, V_SKYBLUE);
-                }
-                for (int i = 0; i < (int)notifications.size(); i++) DrawText(notifications[i].text.c_str(), SCREEN_WIDTH/2 - MeasureText(notifications[i].text.c_str(), 30)/2, 110 + (i * 45), 30, ColorAlpha(notifications[i].col, notifications[i].timer/2.0f));
-                
-                if (currentScreen == GAMEPLAY && !waveActive && enemies.empty()) {
-                    DrawRectangle(0, SCREEN_HEIGHT - UI_FOOTER_HEIGHT, SCREEN_WIDTH, UI_FOOTER_HEIGHT, ColorAlpha(V_BLACK, 0.85f));
-                    DrawText("SYSTEM IDLE // BUILD PHASE", 40, SCREEN_HEIGHT - 55, 20, V_SKYBLUE);
-                    std::string p = "[1] STANDARD"; if(cryoUnlocked) p += " | [2] CRYO"; if(teslaUnlocked) p += " | [3] TESLA"; DrawText(p.c_str(), 40, SCREEN_HEIGHT - 75, 18, V_DARKGRAY);
-                    if (DrawCustomButton({ SCREEN_WIDTH - 550, SCREEN_HEIGHT - 72, 250, 60 }, "OPEN ARMORY [U]", V_GOLD)) currentScreen = UPGRADE_MENU;
-                    if (DrawCustomButton({ SCREEN_WIDTH - 280, SCREEN_HEIGHT - 72, 250, 60 }, "START WAVE", V_LIME)) {
-                        currentWave++; waveActive = true; enemiesToSpawn = 7 + (currentWave * 5); 
-                        waveIntroTimer = 2.5f; 
-                        if (currentWave % 10 == 0) bossInQueue = true;
-                    }
-                }
-                if (currentScreen == UPGRADE_MENU) {
-                    DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_BLACK, 0.9f));
-                    DrawText("SYSTEM ARMORY", SCREEN_WIDTH/2 - 120, 60, 35, V_SKYBLUE); DrawText(TextFormat("AVAILABLE DATA: %d", currency), SCREEN_WIDTH/2 - MeasureText(TextFormat("AVAILABLE DATA: %d", currency), 24)/2, 120, 24, V_GOLD);
-                    int sC = 400 + (maxTowers - 3) * 350; int fC = 600 + (int)((0.8f - towerFireRate) * 10000); 
-                    
-                    DrawCustomButton({ SCREEN_WIDTH/2 - 200, 180, 400, 65 }, TextFormat("BUY NODE SLOT (%d)", sC), V_LIME);
-                    DrawCustomButton({ SCREEN_WIDTH/2 - 200, 260, 400, 65 }, "PULSE CHARGE (300)", V_SKYBLUE);
-                    DrawCustomButton({ SCREEN_WIDTH/2 - 200, 340, 400, 65 }, TextFormat("OVERCLOCK FIRE (%d)", fC), V_GOLD);
-                    DrawCustomButton({ SCREEN_WIDTH/2 - 200, 420, 400, 65 }, "CORE REPAIR (450)", V_CYAN);
-                    
-                    DrawText("PRESS [U] TO DISMISS", SCREEN_WIDTH/2 - 115, 540, 20, V_DARKGRAY);
-                }
-            } else if (currentScreen == GAME_OVER) {
-                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, { 40, 10, 12, 255 });
-                DrawText("SYSTEM FAILURE", SCREEN_WIDTH/2 - MeasureText("SYSTEM FAILURE", 45)/2, 60, 45, V_RED);
-                int bW = 800, bH = 420, bX = SCREEN_WIDTH/2 - bW/2, bY = 140;
-                DrawRectangle(bX, bY, bW, bH, ColorAlpha(V_BLACK, 0.7f)); DrawRectangleLines(bX, bY, bW, bH, V_DARKGRAY);
-                DrawText("MISSION PERFORMANCE LOG", bX + 40, bY + 30, 26, V_SKYBLUE); 
-                DrawText(TextFormat("TOTAL DATA: %d", score), bX + 40, bY + 90, 20, V_WHITE); 
-                DrawText(TextFormat("WAVE DEPTH: %d", currentWave), bX + 40, bY + 125, 20, V_WHITE); 
-                DrawText(TextFormat("REMAINING FRAGMENTS: %d", currency), bX + 40, bY + 160, 20, V_GOLD);
-                
-                DrawText("FINAL CONFIG:", bX + 440, bY + 90, 20, V_LIME); 
-                DrawText(TextFormat("- NODES: %d", maxTowers), bX + 440, bY + 125, 18, V_WHITE); 
-                DrawText(TextFormat("- RECHARGE: %.2fs", towerFireRate), bX + 440, bY + 155, 18, V_WHITE);
-                
-                if (!scoreSaved) { 
-                    DrawText("RECOVER SURVIVOR DATA?", bX + 40, bY + 230, 22, V_CYAN); 
-                    DrawRectangle(bX + 40, bY + 270, 300, 50, ColorAlpha(V_DARKGRAY, 0.5f)); 
-                    DrawRectangleLines(bX + 40, bY + 270, 300, 50, V_CYAN); 
-                    DrawText(playerName, bX + 55, bY + 282, 24, V_WHITE); 
-                    if ((GetTime() * 2) - (int)(GetTime() * 2) > 0.5) { DrawRectangle(bX + 55 + MeasureText(playerName, 24), bY + 280, 15, 30, V_WHITE); }
-                    if (DrawCustomButton({ (float)bX + 360, (float)bY + 270, 200, 50 }, "SAVE DATA", V_CYAN, 20)) { SaveScore(playerName, score); scoreSaved = true; } 
-                } else { DrawText("DATA SYNCED TO HALL OF FAME", bX + 40, bY + 282, 22, V_LIME); }
-                
-                if (DrawCustomButton({ SCREEN_WIDTH/2 - 150, 600, 300, 65 }, "REBOOT SYSTEM", V_GOLD)) { 
-                    score = 0; currency = 0; currentWave = 0; pulseWaveCharges = 0; coreHealth = maxCoreHealth; 
-                    towers.clear(); enemies.clear(); lasers.clear(); powerups.clear(); particles.clear(); notifications.clear(); 
-                    maxTowers = 3; towerFireRate = 0.8f; currentScreen = GAMEPLAY; waveActive = false; cryoUnlocked = false; teslaUnlocked = false; 
-                }
+struct ParticlePool {
+    std::vector<float> posX, posY, velX, velY, life, seek; // seek is 1.0f for core-seeking, else 0.0f
+    std::vector<float> prevX, prevY; // Position before the last Update(), for render interpolation
+    std::vector<Color> col;
+    int count = 0;
+
+    ParticlePool() { for (auto* c : { &posX, &posY, &velX, &velY, &life, &seek, &prevX, &prevY }) c->resize(MAX_PARTICLES); col.resize(MAX_PARTICLES); }
+    ParticlePool(const ParticlePool& o) : ParticlePool() { *this = o; }
+    // Copies only the live prefix; snapshots are taken every tick.
+    ParticlePool& operator=(const ParticlePool& o) {
+        count = o.count;
+        std::copy_n(o.posX.begin(), count, posX.begin()); std::copy_n(o.posY.begin(), count, posY.begin());
+        std::copy_n(o.velX.begin(), count, velX.begin()); std::copy_n(o.velY.begin(), count, velY.begin());
+        std::copy_n(o.life.begin(), count, life.begin()); std::copy_n(o.seek.begin(), count, seek.begin()); std::copy_n(o.col.begin(), count, col.begin());
+        std::copy_n(o.prevX.begin(), count, prevX.begin()); std::copy_n(o.prevY.begin(), count, prevY.begin());
+        return *this;
+    }
+
+    int Size() const { return count; }
+    void Clear() { count = 0; }
+
+    void Spawn(const Particle& p) {
+        if (count >= MAX_PARTICLES) return;
+        posX[count] = prevX[count] = p.pos.x; posY[count] = prevY[count] = p.pos.y; velX[count] = p.vel.x; velY[count] = p.vel.y;
+        life[count] = p.life; seek[count] = p.seekingCore ? 1.0f : 0.0f; col[count] = p.col; count++;
+    }
+
+    void Update(Vector2 core, float dt) {
+        std::copy_n(posX.begin(), count, prevX.begin()); std::copy_n(posY.begin(), count, prevY.begin());
+        float* px = posX.data(); float* py = posY.data(); float* lf = life.data();
+        const float* vx = velX.data(); const float* vy = velY.data(); const float* sk = seek.data();
+        const float step = PARTICLE_SEEK_SPEED * dt, absorb2 = PARTICLE_ABSORB_RADIUS * PARTICLE_ABSORB_RADIUS;
+        int i = 0;
+#if defined(VD_SIMD_SSE2)
+        const __m128 vdt = _mm_set1_ps(dt), vstep = _mm_set1_ps(step), cx = _mm_set1_ps(core.x), cy = _mm_set1_ps(core.y);
+        const __m128 vabsorb = _mm_set1_ps(absorb2), eps = _mm_set1_ps(1e-6f), zero = _mm_setzero_ps();
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_loadu_ps(px + i), y = _mm_loadu_ps(py + i), l = _mm_sub_ps(_mm_loadu_ps(lf + i), vdt);
+            __m128 fx = _mm_add_ps(x, _mm_mul_ps(_mm_loadu_ps(vx + i), vdt)), fy = _mm_add_ps(y, _mm_mul_ps(_mm_loadu_ps(vy + i), vdt));
+            __m128 dx = _mm_sub_ps(cx, x), dy = _mm_sub_ps(cy, y);
+            __m128 k = _mm_div_ps(vstep, _mm_sqrt_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), eps)));
+            __m128 sx = _mm_add_ps(x, _mm_mul_ps(dx, k)), sy = _mm_add_ps(y, _mm_mul_ps(dy, k));
+            __m128 ex = _mm_sub_ps(cx, sx), ey = _mm_sub_ps(cy, sy);
+            __m128 m = _mm_cmpgt_ps(_mm_loadu_ps(sk + i), zero);
+            __m128 absorbed = _mm_and_ps(m, _mm_cmplt_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), vabsorb));
+            _mm_storeu_ps(px + i, _mm_or_ps(_mm_and_ps(m, sx), _mm_andnot_ps(m, fx)));
+            _mm_storeu_ps(py + i, _mm_or_ps(_mm_and_ps(m, sy), _mm_andnot_ps(m, fy)));
+            _mm_storeu_ps(lf + i, _mm_andnot_ps(absorbed, l));
+        }
+#elif defined(VD_SIMD_NEON)
+        const float32x4_t vdt = vdupq_n_f32(dt), vstep = vdupq_n_f32(step), cx = vdupq_n_f32(core.x), cy = vdupq_n_f32(core.y);
+        const float32x4_t vabsorb = vdupq_n_f32(absorb2), eps = vdupq_n_f32(1e-6f), zero = vdupq_n_f32(0.0f);
+        for (; i + 4 <= count; i += 4) {
+            float32x4_t x = vld1q_f32(px + i), y = vld1q_f32(py + i), l = vsubq_f32(vld1q_f32(lf + i), vdt);
+            float32x4_t fx = vmlaq_f32(x, vld1q_f32(vx + i), vdt), fy = vmlaq_f32(y, vld1q_f32(vy + i), vdt);
+            float32x4_t dx = vsubq_f32(cx, x), dy = vsubq_f32(cy, y);
+            float32x4_t k = vdivq_f32(vstep, vsqrtq_f32(vmaxq_f32(vmlaq_f32(vmulq_f32(dx, dx), dy, dy), eps)));
+            float32x4_t sx = vmlaq_f32(x, dx, k), sy = vmlaq_f32(y, dy, k);
+            float32x4_t ex = vsubq_f32(cx, sx), ey = vsubq_f32(cy, sy);
+            uint32x4_t m = vcgtq_f32(vld1q_f32(sk + i), zero);
+            uint32x4_t absorbed = vandq_u32(m, vcltq_f32(vmlaq_f32(vmulq_f32(ex, ex), ey, ey), vabsorb));
+            vst1q_f32(px + i, vbslq_f32(m, sx, fx));
+            vst1q_f32(py + i, vbslq_f32(m, sy, fy));
+            vst1q_f32(lf + i, vbslq_f32(absorbed, zero, l));
+        }
+#endif
+        for (; i < count; i++) {
+            lf[i] -= dt;
+            if (sk[i] > 0) {
+                float dx = core.x - px[i], dy = core.y - py[i], k = step / sqrtf(std::max(dx*dx + dy*dy, 1e-6f));
+                px[i] += dx * k; py[i] += dy * k;
+                if (GetDistanceSqr({ px[i], py[i] }, core) < absorb2) lf[i] = 0;
+            } else { px[i] += vx[i] * dt; py[i] += vy[i] * dt; }
+        }
+
+        for (int j = 0; j < count;) {
+            if (lf[j] > 0) { j++; continue; }
+            count--;
+            posX[j] = posX[count]; posY[j] = posY[count]; velX[j] = velX[count]; velY[j] = velY[count];
+            life[j] = life[count]; seek[j] = seek[count]; col[j] = col[count]; prevX[j] = prevX[count]; prevY[j] = prevY[count];
+        }
+    }
+};
+
+void SpawnParticleBurst(ParticlePool& particles, Rng& rng, Vector2 pos, Color col, int count, float speed) {
+    for (int i = 0; i < count; i++) {
+        float angle = (float)rng.Range(0, 360) * DEG2RAD;
+        float s = (float)rng.Range(50, 200) * 0.01f * speed;
+        particles.Spawn({ pos, {cosf(angle) * s, sinf(angle) * s}, col, 1.0f, 1.0f, false });
+    }
+}
+
+// Submits every particle as a 4x4 quad inside one rlgl batch instead of a DrawCircle each.
+// Positions are blended from the previous tick by alpha; quads outside [x0,x1]x[y0,y1] are skipped.
+void DrawParticles(const ParticlePool& particles, float alpha, float x0, float y0, float x1, float y1) {
+    const int chunk = 1024;
+    x0 -= 2; y0 -= 2; x1 += 2; y1 += 2;
+    for (int base = 0; base < particles.count; base += chunk) {
+        int end = std::min(particles.count, base + chunk);
+        rlCheckRenderBatchLimit((end - base) * 6);
+        rlBegin(RL_TRIANGLES);
+            for (int i = base; i < end; i++) {
+                float x = particles.prevX[i] + (particles.posX[i] - particles.prevX[i]) * alpha;
+                float y = particles.prevY[i] + (particles.posY[i] - particles.prevY[i]) * alpha; Color c = particles.col[i];
+                if (x < x0 || x > x1 || y < y0 || y > y1) continue;
+                rlColor4ub(c.r, c.g, c.b, c.a);
+                rlVertex2f(x - 2, y - 2); rlVertex2f(x - 2, y + 2); rlVertex2f(x + 2, y + 2);
+                rlVertex2f(x - 2, y - 2); rlVertex2f(x + 2, y + 2); rlVertex2f(x + 2, y - 2);
             }
-        EndDrawing();
+        rlEnd();
     }
+}
 
-    // --- CLEANUP ---
-    UnloadSound(sndBlip); UnloadSound(sndBoom); UnloadSound(sndShoot); 
-    UnloadShader(bloom); UnloadRenderTexture(target); 
-    CloseAudioDevice(); CloseWindow(); 
-    return 0;
-}
\ No newline at end of file
+// --- TRANSIENT POOLS ---
+// Fixed-capacity inline store for short-lived effects (lasers, power-ups, notifications).
+// Adds past capacity are dropped. Sweep ages every entry and compacts out the expired
+// ones in a single pass, keeping the survivors in insertion order (notifications stack by
+// index, power-up pickup takes the first hit), so a removal costs one move, not an erase.
+const int MAX_LASERS = 1024;
+const int MAX_POWERUPS = 64;
+const int MAX_NOTIFICATIONS = 16;
+
+template <typename T, int N>
+struct TransientPool {
+    std::array<T, N> items;
+    int count = 0;
+
+    TransientPool() = default;
+    TransientPool(const TransientPool& o) { *this = o; }
+    // Copies only the live prefix; snapshots are taken every tick.
+    TransientPool& operator=(const TransientPool& o) { count = o.count; std::copy_n(o.items.begin(), count, items.begin()); return *this; }
+
+    int Size() const { return count; }
+    bool Empty() const { return count == 0; }
+    void Clear() { count = 0; }
+    void Add(const T& item) { if (count < N) items[count++] = item; }
+
+    // keep(item) updates one entry and returns false once it has expired.
+    template <typename Fn> void Sweep(Fn&& keep) {
+        int live = 0;
+        for (int i = 0; i < count; i++) if (keep(items[i])) { if (live != i) items[live] = items[i]; live++; }
+        count = live;
+    }
+
+    T& operator[](int i) { return items[i]; }
+    const T& operator[](int i) const { return items[i]; }
+    T* begin() { return items.data(); }
+    T* end() { return items.data() + count; }
+    const T* begin() const { return items.data(); }
+    const T* end() const { return items.data() + count; }
+};
+
+// --- POLYGON BATCH RENDERER ---
+// Collects polygon instances into per-side-count buckets and emits them from
+// precomputed unit-polygon tables, so no entity calls sin/cos per vertex. All fills
+// are submitted before all outlines, matching DrawPoly + DrawPolyLinesEx per entity.
+const int MAX_POLY_SIDES = 24;
+
+struct PolyInstance {
+    float x, y, radius, rotation, lineThick;
+    Color fill, line; // fill.a == 0 skips the fill
+};
+
+struct PolyBatch {
+    float unitX[MAX_POLY_SIDES + 1][MAX_POLY_SIDES + 1], unitY[MAX_POLY_SIDES + 1][MAX_POLY_SIDES + 1];
+    float innerScale[MAX_POLY_SIDES + 1]; // DrawPolyLinesEx inset: lineThick * cos(pi / sides)
+    std::vector<PolyInstance> buckets[MAX_POLY_SIDES + 1];
+
+    PolyBatch() {
+        for (int sides = 3; sides <= MAX_POLY_SIDES; sides++) {
+            for (int k = 0; k <= sides; k++) { float a = (360.0f / sides) * (k % sides) * DEG2RAD; unitX[sides][k] = cosf(a); unitY[sides][k] = sinf(a); }
+            innerScale[sides] = cosf(DEG2RAD * (360.0f / sides) / 2.0f);
+            buckets[sides].reserve(64);
+        }
+    }
+
+    void Add(Vector2 pos, int sides, float radius, float rotation, float lineThick, Color fill, Color line) {
+        if (sides < 3 || sides > MAX_POLY_SIDES) return;
+        buckets[sides].push_back({ pos.x, pos.y, radius, rotation, lineThick, fill, line });
+    }
+
+    // Same look as the old DrawHealthBody: translucent fill above half health, outline always.
+    void AddHealthBody(Vector2 pos, int sides, float radius, float healthRatio, Color col) {
+        Add(pos, sides, radius, 0.0f, 2.5f, healthRatio > 0.5f ? ColorAlpha(col, healthRatio * 0.4f) : BLANK, ColorAlpha(col, healthRatio + 0.2f));
+    }
+
+    void Flush() {
+        for (int sides = 3; sides <= MAX_POLY_SIDES; sides++) {
+            const float* ux = unitX[sides]; const float* uy = unitY[sides];
+            for (const PolyInstance& p : buckets[sides]) {
+                if (p.fill.a == 0) continue;
+                float cr = 1.0f, sr = 0.0f; if (p.rotation != 0.0f) { cr = cosf(p.rotation * DEG2RAD); sr = sinf(p.rotation * DEG2RAD); }
+                rlCheckRenderBatchLimit(sides * 3);
+                rlBegin(RL_TRIANGLES);
+                    rlColor4ub(p.fill.r, p.fill.g, p.fill.b, p.fill.a);
+                    for (int k = 0; k < sides; k++) {
+                        float ax = (ux[k] * cr - uy[k] * sr) * p.radius, ay = (ux[k] * sr + uy[k] * cr) * p.radius;
+                        float bx = (ux[k + 1] * cr - uy[k + 1] * sr) * p.radius, by = (ux[k + 1] * sr + uy[k + 1] * cr) * p.radius;
+                        rlVertex2f(p.x, p.y); rlVertex2f(p.x + bx, p.y + by); rlVertex2f(p.x + ax, p.y + ay);
+                    }
+                rlEnd();
+            }
+        }
+        for (int sides = 3; sides <= MAX_POLY_SIDES; sides++) {
+            const float* ux = unitX[sides]; const float* uy = unitY[sides];
+            for (const PolyInstance& p : buckets[sides]) {
+                float cr = 1.0f, sr = 0.0f; if (p.rotation != 0.0f) { cr = cosf(p.rotation * DEG2RAD); sr = sinf(p.rotation * DEG2RAD); }
+                float outer = p.radius, inner = p.radius - p.lineThick * innerScale[sides];
+                rlCheckRenderBatchLimit(sides * 6);
+                rlBegin(RL_TRIANGLES);
+                    rlColor4ub(p.line.r, p.line.g, p.line.b, p.line.a);
+                    for (int k = 0; k < sides; k++) {
+                        float ax = ux[k] * cr - uy[k] * sr, ay = ux[k] * sr + uy[k] * cr;
+                        float bx = ux[k + 1] * cr - uy[k + 1] * sr, by = ux[k + 1] * sr + uy[k + 1] * cr;
+                        rlVertex2f(p.x + ax * outer, p.y + ay * outer); rlVertex2f(p.x + ax * inner, p.y + ay * inner); rlVertex2f(p.x + bx * inner, p.y + by * inner);
+                        rlVertex2f(p.x + ax * outer, p.y + ay * outer); rlVertex2f(p.x + bx * inner, p.y + by * inner); rlVertex2f(p.x + bx * outer, p.y + by * outer);
+                    }
+                rlEnd();
+            }
+            buckets[sides].clear();
+        }
+    }
+};
+
+// --- BLOOM PIPELINE ---
+// OFF draws the scene as-is. LOW blurs once at quarter resolution, HIGH twice at half.
+// The blur targets are reallocated only when the preset or the scene size changes.
+enum BloomQuality { BLOOM_OFF, BLOOM_LOW, BLOOM_HIGH };
+const char* BLOOM_QUALITY_NAMES[] = { "OFF", "LOW", "HIGH" };
+
+struct BloomPipeline {
+    Shader bright = { 0 }, blur = { 0 }, composite = { 0 };
+    int thresholdLoc = -1, directionLoc = -1, bloomTextureLoc = -1, intensityLoc = -1;
+    RenderTexture2D ping = { 0 }, pong = { 0 };
+    BloomQuality quality = BLOOM_HIGH;
+    int sceneW = 0, sceneH = 0;
+
+    void Load() {
+        bright = LoadShaderFromMemory(0, bloomBrightShaderCode);
+        blur = LoadShaderFromMemory(0, bloomBlurShaderCode);
+        composite = LoadShaderFromMemory(0, bloomCompositeShaderCode);
+        thresholdLoc = GetShaderLocation(bright, "threshold");
+        directionLoc = GetShaderLocation(blur, "direction");
+        bloomTextureLoc = GetShaderLocation(composite, "bloomTexture");
+        intensityLoc = GetShaderLocation(composite, "intensity");
+    }
+
+    void ReleaseTargets() {
+        if (ping.id != 0) UnloadRenderTexture(ping);
+        if (pong.id != 0) UnloadRenderTexture(pong);
+        ping = pong = RenderTexture2D{ 0 };
+    }
+
+    void Unload() { ReleaseTargets(); UnloadShader(bright); UnloadShader(blur); UnloadShader(composite); }
+
+    void SetQuality(BloomQuality q) { if (q != quality) { quality = q; ReleaseTargets(); } }
+    void CycleQuality() { SetQuality((BloomQuality)((quality + 1) % 3)); }
+
+    void EnsureTargets(int w, int h) {
+        if (ping.id != 0 && w == sceneW && h == sceneH) return;
+        ReleaseTargets(); sceneW = w; sceneH = h;
+        int divisor = (quality == BLOOM_HIGH) ? 2 : 4;
+        ping = LoadRenderTexture(w / divisor, h / divisor); pong = LoadRenderTexture(w / divisor, h / divisor);
+        SetTextureFilter(ping.texture, TEXTURE_FILTER_BILINEAR); SetTextureFilter(pong.texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    // Draws `src` stretched over `dst` through `shader`. Render textures are stored
+    // upside down, so every pass samples with a negative source height.
+    static void Pass(const RenderTexture2D& src, const RenderTexture2D& dst, Shader shader) {
+        TexturePass(dst, [&] {
+            ClearBackground(BLACK);
+            BeginShaderMode(shader);
+                DrawTexturePro(src.texture, { 0, 0, (float)src.texture.width, (float)-src.texture.height }, { 0, 0, (float)dst.texture.width, (float)dst.texture.height }, { 0, 0 }, 0.0f, WHITE);
+            EndShaderMode();
+        });
+    }
+
+    // Runs the chain on `scene` and composites the result to the current framebuffer at `dest`,
+    // in the caller's coordinates; the scene may be smaller or larger than `dest`.
+    void Apply(const RenderTexture2D& scene, Rectangle dest) {
+        Rectangle src = { 0, 0, (float)scene.texture.width, (float)-scene.texture.height };
+        if (quality == BLOOM_OFF) { DrawTexturePro(scene.texture, src, dest, { 0, 0 }, 0.0f, WHITE); return; }
+
+        EnsureTargets(scene.texture.width, scene.texture.height);
+        float threshold = 0.12f, intensity = (quality == BLOOM_HIGH) ? 1.35f : 1.1f;
+        SetShaderValue(bright, thresholdLoc, &threshold, SHADER_UNIFORM_FLOAT);
+        Pass(scene, ping, bright);
+
+        int iterations = (quality == BLOOM_HIGH) ? 2 : 1;
+        for (int i = 0; i < iterations; i++) {
+            float h[2] = { 1.0f / ping.texture.width, 0.0f }, v[2] = { 0.0f, 1.0f / ping.texture.height };
+            SetShaderValue(blur, directionLoc, h, SHADER_UNIFORM_VEC2); Pass(ping, pong, blur);
+            SetShaderValue(blur, directionLoc, v, SHADER_UNIFORM_VEC2); Pass(pong, ping, blur);
+        }
+
+        BeginShaderMode(composite);
+            SetShaderValueTexture(composite, bloomTextureLoc, ping.texture);
+            SetShaderValue(composite, intensityLoc, &intensity, SHADER_UNIFORM_FLOAT);
+            DrawTexturePro(scene.texture, src, dest, { 0, 0 }, 0.0f, WHITE);
+        EndShaderMode();
+    }
+};
+
+// --- SPATIAL GRID ---
+// Uniform broad-phase over the spawn ring around the core. Rebuilt from scratch each
+// tick with a counting sort into flat arrays, so it allocates nothing once warmed up.
+// Positions outside the bounds clamp into the border cells, which keeps queries exact.
+const float GRID_CELL_SIZE = 64.0f;
+const float GRID_HALF_EXTENT = 900.0f; // Covers the 850 px spawn ring plus boss radius
+
+struct SpatialGrid {
+    float originX = 0, originY = 0;
+    int cols = 0, rows = 0;
+    std::vector<int> cellStart; // cols*rows + 1 offsets into cellItems
+    std::vector<int> cellItems; // Enemy indices grouped by cell
+    std::vector<int> itemCell;
+
+    SpatialGrid() { cellItems.reserve(ENEMY_RESERVE); itemCell.reserve(ENEMY_RESERVE); }
+
+    void Init(Vector2 center) {
+        originX = center.x - GRID_HALF_EXTENT; originY = center.y - GRID_HALF_EXTENT;
+        cols = rows = (int)ceilf((GRID_HALF_EXTENT * 2) / GRID_CELL_SIZE);
+        cellStart.assign(cols * rows + 1, 0);
+    }
+
+    int CellX(float x) const { return std::clamp((int)floorf((x - originX) / GRID_CELL_SIZE), 0, cols - 1); }
+    int CellY(float y) const { return std::clamp((int)floorf((y - originY) / GRID_CELL_SIZE), 0, rows - 1); }
+
+    // Entries flagged by MarkRemove() are left out.
+    void Build(const EnemyStore& enemies) {
+        int n = enemies.Size();
+        std::fill(cellStart.begin(), cellStart.end(), 0);
+        itemCell.resize(n); cellItems.resize(n);
+        for (int i = 0; i < n; i++) { if (enemies.removed[i]) { itemCell[i] = -1; continue; } int c = CellY(enemies.posY[i]) * cols + CellX(enemies.posX[i]); itemCell[i] = c; cellStart[c + 1]++; }
+        for (int c = 0; c < cols * rows; c++) cellStart[c + 1] += cellStart[c];
+        // Scatter, then shift the offsets back: cellStart[c] ends up at the start of cell c again.
+        for (int i = 0; i < n; i++) if (itemCell[i] >= 0) cellItems[cellStart[itemCell[i]]++] = i;
+        for (int c = cols * rows; c > 0; c--) cellStart[c] = cellStart[c - 1];
+        cellStart[0] = 0;
+    }
+
+    // Calls fn(index, distSqr) for every enemy whose centre lies strictly within radius of pos.
+    template <typename Fn>
+    void ForEachInRadius(const EnemyStore& enemies, Vector2 pos, float radius, Fn&& fn) const {
+        float r2 = radius * radius;
+        int x0 = CellX(pos.x - radius), x1 = CellX(pos.x + radius), y0 = CellY(pos.y - radius), y1 = CellY(pos.y + radius);
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++) {
+                int c = cy * cols + cx;
+                for (int k = cellStart[c]; k < cellStart[c + 1]; k++) {
+                    int i = cellItems[k]; float dx = enemies.posX[i] - pos.x, dy = enemies.posY[i] - pos.y, d2 = dx*dx + dy*dy;
+                    if (d2 < r2) fn(i, d2);
+                }
+            }
+        }
+    }
+
+    // Calls fn(index) for every enemy binned in a cell overlapping the rectangle; callers refine.
+    template <typename Fn>
+    void ForEachInCells(float x0, float y0, float x1, float y1, Fn&& fn) const {
+        for (int cy = CellY(y0), cy1 = CellY(y1); cy <= cy1; cy++)
+            for (int cx = CellX(x0), cx1 = CellX(x1); cx <= cx1; cx++)
+                for (int k = cellStart[cy * cols + cx]; k < cellStart[cy * cols + cx + 1]; k++) fn(cellItems[k]);
+    }
+
+    // True when the last Build() binned every live entry, i.e. indices are still valid.
+    bool Covers(const EnemyStore& enemies) const { return !cellStart.empty() && cellStart.back() == enemies.Size() - enemies.removedCount; }
+
+    // Index of the closest enemy within maxDist of pos, skipping `exclude`; -1 if none.
+    int Nearest(const EnemyStore& enemies, Vector2 pos, float maxDist, int exclude = -1) const {
+        int best = -1; float bestD2 = maxDist * maxDist;
+        ForEachInRadius(enemies, pos, maxDist, [&](int i, float d2) { if (i != exclude && (d2 < bestD2 || (d2 == bestD2 && i < best))) { bestD2 = d2; best = i; } });
+        return best;
+    }
+};
+
+// --- FRAME PROFILER ---
+// Scoped wall-clock timers per pipeline stage, accumulated into the current frame (from
+// any thread) and pushed into a fixed ring buffer at EndFrame. [F3] toggles the overlay, [F4] dumps the
+// history to profile.csv. Timers are no-ops while `enabled` is false (headless runs).
+enum ProfileStage { PROF_SPAWN, PROF_ENEMIES, PROF_TOWERS, PROF_PARTICLES, PROF_WORLD_DRAW, PROF_BLOOM, PROF_HUD, PROF_PRESENT, PROF_COUNT };
+const char* PROFILE_STAGE_NAMES[PROF_COUNT] = { "spawn", "enemies", "towers", "particles", "world_draw", "bloom", "hud", "present" };
+const Color PROFILE_STAGE_COLORS[PROF_COUNT] = { V_PURPLE, V_RED, V_LIME, V_CYAN, V_SKYBLUE, V_GOLD, V_WHITE, { 90, 90, 100, 255 } };
+static_assert(PROF_COUNT + 1 <= ALLOC_SLOTS, "stage s allocates into slot s + 1");
+
+struct FrameRecord {
+    float frameMs;
+    float stageMs[PROF_COUNT];
+    int enemies, particles, lasers;
+    float inputMs; // Input-to-present latency of an input first shown this frame; 0 = none
+    uint32_t allocs[PROF_COUNT + 1], allocBytes[PROF_COUNT + 1]; // [0] = outside any stage; VD_ALLOC_TRACKING only
+    uint64_t allocTotal; // Every thread, always counted
+};
+
+struct FrameProfiler {
+    static constexpr int HISTORY = 600;
+    FrameRecord history[HISTORY];
+    FrameRecord current = {};
+    int head = 0, filled = 0;
+    bool enabled = false, overlayVisible = false;
+    std::chrono::steady_clock::time_point frameStart;
+    std::atomic<uint64_t> pendingNs[PROF_COUNT] = {}; // Simulation stages are timed on the sim thread
+    uint64_t allocMark = 0;
+
+    void BeginFrame() { current = {}; frameStart = std::chrono::steady_clock::now(); }
+    void AddStage(ProfileStage stage, double ms) { pendingNs[stage].fetch_add((uint64_t)(ms * 1e6), std::memory_order_relaxed); }
+
+    void EndFrame(int enemies, int particles, int lasers, float inputMs = 0.0f) {
+        if (!enabled) return;
+        for (int s = 0; s < PROF_COUNT; s++) current.stageMs[s] = (float)(pendingNs[s].exchange(0, std::memory_order_relaxed) * 1e-6);
+        current.frameMs = (float)std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        current.enemies = enemies; current.particles = particles; current.lasers = lasers; current.inputMs = inputMs;
+        uint64_t allocNow = gAllocationCount.load(std::memory_order_relaxed); current.allocTotal = allocNow - allocMark; allocMark = allocNow;
+        for (int s = 0; ALLOC_TRACKING && s <= PROF_COUNT; s++) {
+            current.allocs[s] = (uint32_t)gAllocsBySlot[s].exchange(0, std::memory_order_relaxed);
+            current.allocBytes[s] = (uint32_t)gAllocBytesBySlot[s].exchange(0, std::memory_order_relaxed);
+        }
+        history[head] = current; head = (head + 1) % HISTORY; filled = std::min(filled + 1, HISTORY);
+    }
+
+    // i = 0 is the most recent completed frame.
+    const FrameRecord& Recent(int i) const { return history[(head - 1 - i + HISTORY) % HISTORY]; }
+
+    bool DumpCSV(const char* path) const {
+        std::ofstream file(path);
+        if (!file) return false;
+        file << "frame,frame_ms";
+        for (int s = 0; s < PROF_COUNT; s++) file << "," << PROFILE_STAGE_NAMES[s] << "_ms";
+        file << ",enemies,particles,lasers,input_ms,allocs";
+        for (int s = 0; ALLOC_TRACKING && s <= PROF_COUNT; s++) file << "," << (s ? PROFILE_STAGE_NAMES[s - 1] : "other") << "_allocs," << (s ? PROFILE_STAGE_NAMES[s - 1] : "other") << "_bytes";
+        file << "\n";
+        for (int i = filled - 1; i >= 0; i--) {
+            const FrameRecord& r = Recent(i);
+            file << (filled - 1 - i) << "," << r.frameMs;
+            for (int s = 0; s < PROF_COUNT; s++) file << "," << r.stageMs[s];
+            file << "," << r.enemies << "," << r.particles << "," << r.lasers << "," << r.inputMs << "," << r.allocTotal;
+            for (int s = 0; ALLOC_TRACKING && s <= PROF_COUNT; s++) file << "," << r.allocs[s] << "," << r.allocBytes[s];
+            file << "\n";
+        }
+        return true;
+    }
+
+    void DrawOverlay(int x, int y) const {
+        if (!overlayVisible || filled == 0) return;
+        const int graphW = 300, graphH = 90, bars = std::min(filled, graphW / 2);
+        const float msScale = graphH / 33.3f; // Full height = two 60 Hz frames
+        DrawRectangle(x, y, graphW + 20, graphH + 60 + PROF_COUNT * 16, ColorAlpha(V_BLACK, 0.85f));
+        DrawRectangleLines(x, y, graphW + 20, graphH + 60 + PROF_COUNT * 16, V_DARKGRAY);
+        int gx = x + 10, gy = y + 10;
+        DrawLine(gx, gy + graphH - (int)(16.6f * msScale), gx + graphW, gy + graphH - (int)(16.6f * msScale), ColorAlpha(V_LIME, 0.5f));
+        for (int i = 0; i < bars; i++) {
+            const FrameRecord& r = Recent(i);
+            int bx = gx + graphW - (i + 1) * 2, h = std::min(graphH, (int)(r.frameMs * msScale));
+            DrawRectangle(bx, gy + graphH - h, 2, h, r.frameMs > 16.7f ? V_RED : ColorAlpha(V_SKYBLUE, 0.8f));
+        }
+
+        float avg[PROF_COUNT] = {}, avgFrame = 0.0f, worst = 0.0f; int n = std::min(filled, 60);
+        uint64_t allocs[PROF_COUNT + 1] = {}, allocTotal = 0;
+        for (int i = 0; i < n; i++) {
+            const FrameRecord& r = Recent(i); avgFrame += r.frameMs; worst = std::max(worst, r.frameMs); allocTotal += r.allocTotal;
+            for (int s = 0; s < PROF_COUNT; s++) avg[s] += r.stageMs[s];
+            for (int s = 0; ALLOC_TRACKING && s <= PROF_COUNT; s++) allocs[s] += r.allocs[s];
+        }
+        float inputSum = 0.0f, inputLast = 0.0f; int inputs = 0; // Over the whole history: inputs are sparse
+        for (int i = filled - 1; i >= 0; i--) if (Recent(i).inputMs > 0) { inputSum += Recent(i).inputMs; inputLast = Recent(i).inputMs; inputs++; }
+        const FrameRecord& last = Recent(0);
+        int ty = gy + graphH + 8;
+        if (inputs) DrawText(TextFormat("INPUT->PRESENT %.1f ms (avg %.1f, %d)", inputLast, inputSum / inputs, inputs), gx, gy + 14, 12, V_CYAN);
+        DrawText(TextFormat("FRAME %.2f ms avg / %.2f ms max", avgFrame / n, worst), gx, ty, 14, V_WHITE);
+        DrawText(TextFormat("ENEMIES %d  PARTICLES %d  LASERS %d", last.enemies, last.particles, last.lasers), gx, ty + 18, 14, V_SKYBLUE);
+        DrawText(TextFormat("ALLOCS %llu in %d frames", (unsigned long long)allocTotal, n), gx + graphW - 140, gy, 12, allocTotal ? V_RED : V_DARKGRAY);
+        for (int s = 0; s < PROF_COUNT; s++) {
+            float ms = avg[s] / n;
+            DrawRectangle(gx, ty + 40 + s * 16, std::min(graphW - 120, (int)(ms * 20.0f)), 10, PROFILE_STAGE_COLORS[s]);
+            DrawText(TextFormat("%-10s %6.3f ms", PROFILE_STAGE_NAMES[s], ms), gx + graphW - 115, ty + 38 + s * 16, 12, PROFILE_STAGE_COLORS[s]);
+            if (ALLOC_TRACKING && allocs[s + 1]) DrawText(TextFormat("%llu", (unsigned long long)allocs[s + 1]), gx + graphW - 150, ty + 38 + s * 16, 12, V_RED);
+        }
+    }
+};
+
+FrameProfiler profiler;
+
+struct ProfileScope {
+    ProfileStage stage; bool active; int outerAllocSlot; std::chrono::steady_clock::time_point t0;
+    explicit ProfileScope(ProfileStage s) : stage(s), active(profiler.enabled), outerAllocSlot(gAllocSlot) { gAllocSlot = s + 1; if (active) t0 = std::chrono::steady_clock::now(); }
+    ~ProfileScope() { Stop(); }
+    // Ends the measurement early, for stages that don't map onto a C++ block.
+    void Stop() {
+        if (outerAllocSlot >= 0) { gAllocSlot = outerAllocSlot; outerAllocSlot = -1; }
+        if (active) { profiler.AddStage(stage, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()); active = false; }
+    }
+};
+
+// --- QUALITY GOVERNOR ---
+// Watches frame times against a budget and steps cosmetic quality down one tier when a
+// window of frames runs long, and back up after sustained headroom. Tiers only touch
+// presentation and fxRng-driven particles, which the state hash and replays ignore.
+enum QualityTier { QUALITY_FULL, QUALITY_REDUCED, QUALITY_LOW, QUALITY_MINIMAL, QUALITY_COUNT };
+
+struct QualitySettings {
+    const char* name;
+    float burstScale;   // Fraction of each particle burst that is spawned
+    int sparkOdds;      // Overdrive spark per tower per tick is 1 in (sparkOdds + 1); -1 disables
+    BloomQuality bloom; // Upper bound on the [F2] preset
+    float shakeCap;     // Camera shake amplitude clamp, px
+    int ringSegments;   // Pulse ring tessellation
+    float renderScale;  // Upper bound on the world's render scale ([F6]/[F7])
+};
+
+const QualitySettings QUALITY_TIERS[QUALITY_COUNT] = {
+    { "FULL",    1.0f,   4, BLOOM_HIGH, INFINITY, 60, INFINITY },
+    { "REDUCED", 0.6f,   9, BLOOM_HIGH, 30.0f,    40, 1.0f },
+    { "LOW",     0.35f, 19, BLOOM_LOW,  15.0f,    28, 0.75f },
+    { "MINIMAL", 0.15f, -1, BLOOM_OFF,  6.0f,     18, 0.5f },
+};
+
+struct QualityGovernor {
+    static constexpr int WINDOW = 30;        // Frames averaged per decision
+    static const int RESTORE_WINDOWS = 6; // Calm windows in a row before stepping back up
+    float budgetMs = 1000.0f / 60.0f;
+    bool enabled = true;
+    int tier = QUALITY_FULL;
+    float sumFrameMs = 0.0f, sumBusyMs = 0.0f;
+    int frames = 0, calmWindows = 0;
+
+    const QualitySettings& Settings() const { return QUALITY_TIERS[enabled ? tier : QUALITY_FULL]; }
+
+    // frameMs is the whole frame; busyMs leaves out present (the vsync/target-FPS wait).
+    void Observe(float frameMs, float busyMs) {
+        if (!enabled) return;
+        sumFrameMs += frameMs; sumBusyMs += busyMs;
+        if (++frames < WINDOW) return;
+        float frame = sumFrameMs / frames, busy = sumBusyMs / frames;
+        sumFrameMs = sumBusyMs = 0.0f; frames = 0;
+        if (frame > budgetMs * 1.1f || busy > budgetMs * 0.9f) { tier = std::min(tier + 1, QUALITY_COUNT - 1); calmWindows = 0; }
+        else if (busy < budgetMs * 0.6f) { if (++calmWindows >= RESTORE_WINDOWS) { tier = std::max(tier - 1, 0); calmWindows = 0; } }
+        else calmWindows = 0;
+    }
+};
+
+// --- TOWER POLICIES ---
+// Each tower type is one policy struct: cadence, damage, on-hit effect, chain behaviour and
+// look. Towers live in one bucket per policy, so the per-shot loops are instantiated once
+// per type with no branching on TowerType. A new type is a new policy added to TowerSet.
+struct StandardTower {
+    static constexpr TowerType TYPE = TWR_STANDARD;
+    static constexpr const char* NAME = "STANDARD";
+    static constexpr int SIDES = 4;
+    static constexpr float RATE_SCALE = 1.0f, DAMAGE = 1.0f, LASER_LIFE = 0.07f;
+    static constexpr float CHAIN_RADIUS = 0.0f, CHAIN_DAMAGE = 0.0f, CHAIN_LASER_LIFE = 0.0f;
+    static Color Body() { return V_LIME; }
+    static Color Laser() { return V_WHITE; }
+    static void OnHit(EnemyStore&, int) {}
+};
+
+struct CryoTower {
+    static constexpr TowerType TYPE = TWR_CRYO;
+    static constexpr const char* NAME = "CRYO";
+    static constexpr int SIDES = 6;
+    static constexpr float RATE_SCALE = 1.5f, DAMAGE = 0.5f, LASER_LIFE = 0.07f;
+    static constexpr float CHAIN_RADIUS = 0.0f, CHAIN_DAMAGE = 0.0f, CHAIN_LASER_LIFE = 0.0f;
+    static constexpr float SLOW_DURATION = 1.5f;
+    static Color Body() { return V_SKYBLUE; }
+    static Color Laser() { return V_SKYBLUE; }
+    static void OnHit(EnemyStore& enemies, int i) { enemies.slowTimer[i] = SLOW_DURATION; }
+};
+
+struct TeslaTower {
+    static constexpr TowerType TYPE = TWR_TESLA;
+    static constexpr const char* NAME = "TESLA";
+    static constexpr int SIDES = 8;
+    static constexpr float RATE_SCALE = 1.5f, DAMAGE = 0.8f, LASER_LIFE = 0.07f;
+    static constexpr float CHAIN_RADIUS = 200.0f, CHAIN_DAMAGE = 0.6f, CHAIN_LASER_LIFE = 0.12f;
+    static Color Body() { return V_GOLD; }
+    static Color Laser() { return V_GOLD; }
+    static void OnHit(EnemyStore&, int) {}
+};
+
+template <typename P>
+struct TowerBucket {
+    using Policy = P;
+    std::vector<Tower> towers;
+};
+
+template <typename... Ps>
+struct TowerSetOf {
+    std::tuple<TowerBucket<Ps>...> buckets;
+    static constexpr int BUCKETS = (int)sizeof...(Ps);
+
+    // fn(bucket) for every bucket, in policy order; the bucket's type exposes ::Policy.
+    template <typename Fn> void ForEach(Fn&& fn) { std::apply([&](auto&... b) { (fn(b), ...); }, buckets); }
+    template <typename Fn> void ForEach(Fn&& fn) const { std::apply([&](const auto&... b) { (fn(b), ...); }, buckets); }
+
+    // fn(Policy{}) for the policy of a runtime TowerType (UI selection, placement).
+    template <typename Fn> static void Dispatch(TowerType type, Fn&& fn) { ((Ps::TYPE == type ? fn(Ps{}) : void()), ...); }
+
+    int Size() const { int n = 0; ForEach([&](const auto& b) { n += (int)b.towers.size(); }); return n; }
+    bool Empty() const { return Size() == 0; }
+    void Clear() { ForEach([](auto& b) { b.towers.clear(); }); }
+    void Add(TowerType type, Vector2 pos) { ForEach([&](auto& b) { if (std::decay_t<decltype(b)>::Policy::TYPE == type) b.towers.push_back({ pos, 0.0f, type }); }); }
+};
+
+using TowerSet = TowerSetOf<StandardTower, CryoTower, TeslaTower>;
+
+// Targets chosen for one tower this tick; -1 when it holds fire.
+struct TowerShot { int target = -1, chain = -1; };
+
+// --- TICK COMMAND BUFFER ---
+// Structural changes made during a tick (wave and boss spawns, splits, power-up drops,
+// particle bursts) are recorded here and applied in one batch at the end of the tick, so
+// no phase ever grows a container it is iterating. Removals stay on the store's deferred
+// MarkRemove() flags and are compacted in the same batch. Random rolls happen when the
+// command is recorded; applying only copies.
+struct ParticleBurst { Vector2 pos; Color col; int count; float speed; };
+
+struct TickCommands {
+    static const int BASE_RESERVE = 1024; // Enemy spawns covered without growing, about wave 60 with splits
+    std::vector<Enemy> spawns;
+    std::vector<PowerUp> drops;
+    std::vector<ParticleBurst> bursts;
+
+    TickCommands() { Reserve(BASE_RESERVE); }
+
+    // A tick can spawn at most the whole wave plus two fragments per kill.
+    void ReserveForWave(int waveSize) { if ((int)spawns.capacity() < waveSize * 3) Reserve(waveSize * 3); }
+    void Reserve(int n) { spawns.reserve(n); drops.reserve(n); bursts.reserve(n); }
+
+    bool Empty() const { return spawns.empty() && drops.empty() && bursts.empty(); }
+    void Clear() { spawns.clear(); drops.clear(); bursts.clear(); }
+};
+
+// --- FAR-FIELD SWARM ---
+// Endless mode (--endless) sends each wave in as one deep horde. An enemy that no tower,
+// pulse or camera can reach yet is not an entity. It is counted in a radial band, keyed by
+// angular sector, side count and depth, that holds a count and a health pool. A band moves
+// implicitly: its distance is a function of the swarm clock and its side count's speed. So
+// the far field costs one check per lane per tick, not one per enemy. A band becomes full
+// Enemy entries once its front crosses its sector's engage radius.
+const int SWARM_SECTORS = 72; // 5 degrees each
+const float SWARM_SECTOR_DEG = 360.0f / SWARM_SECTORS;
+const int SWARM_SECTOR_SAMPLES = 5; // Rays per sector edge-to-edge when computing the engage radius
+const int SWARM_SIDE_KINDS = 8;     // Regular enemies have 3..10 sides
+const int SWARM_LANES = SWARM_SECTORS * SWARM_SIDE_KINDS;
+const float SWARM_BAND_DEPTH = 100.0f;      // Radial extent folded into one band
+const float SWARM_SPAWN_RADIUS = 850.0f;    // The regular spawn ring; the horde's front starts here
+const float SWARM_ENEMY_RADIUS = 22.0f;
+const float SWARM_VIEW_PAD = 96.0f + 45.0f; // Tallest enemy outline plus the largest camera shake
+const int ENDLESS_RAMP = 25;                // An endless wave is 1 + (wave - 1)^2 / ENDLESS_RAMP regular waves: 100k+ by wave 80
+const float PULSE_RADIUS = 450.0f;
+
+struct SwarmBand {
+    float depth;   // Distance of the band's front from the core at swarm clock 0
+    int32_t count;
+    float healthPool;
+};
+
+struct Swarm {
+    std::vector<SwarmBand> bands;            // Grouped by lane, front-most first within a lane
+    std::vector<int32_t> laneHead, laneEnd;  // Per lane (sector * SWARM_SIDE_KINDS + sides - 3); the head advances as bands engage
+    float engageRadius[SWARM_SECTORS] = {};  // Farthest reachable distance along each sector
+    int engageTowers = -1;                   // Tower count engageRadius was computed for; -1 = stale
+    int32_t sectorCount[SWARM_SECTORS] = {};
+    float clock = 0.0f;                      // Seconds of far-field movement; stops under EMP
+    int count = 0;
+
+    bool Empty() const { return count == 0; }
+};
+
+// --- SIMULATION STATE ---
+// Everything the gameplay tick reads or writes. The tick never touches the window,
+// the audio device or any draw call, so it can run headless at any rate.
+struct GameState {
+    Vector2 corePos = { (float)SCREEN_WIDTH / 2, (float)SCREEN_HEIGHT / 2 };
+
+    int coreHealth = 20, maxCoreHealth = 20, score = 0, currency = 0, currentWave = 0, enemiesToSpawn = 0;
+    float spawnTimer = 0.0f;
+    bool waveActive = false, bossInQueue = false;
+
+    int maxTowers = 3;
+    float towerFireRate = 0.8f, towerRange = 230.0f;
+    int pulseWaveCharges = 0;
+    TowerType currentSelection = TWR_STANDARD;
+    bool cryoUnlocked = false, teslaUnlocked = false, pendingCryoNotify = false, pendingTeslaNotify = false;
+
+    float waveIntroTimer = 0.0f, empTimer = 0.0f, overdriveTimer = 0.0f, empWaveRadius = 0.0f, pulseVisualRadius = 0.0f, shakeIntensity = 0.0f, damageFlashTimer = 0.0f;
+
+    EnemyStore enemies;
+    TowerSet towers;
+    TransientPool<Laser, MAX_LASERS> lasers;
+    TransientPool<PowerUp, MAX_POWERUPS> powerups;
+    ParticlePool particles;
+    TransientPool<Notification, MAX_NOTIFICATIONS> notifications;
+
+    SpatialGrid grid; // Enemy broad-phase, valid until the next Add/Compact on `enemies`
+    std::vector<TowerShot> shots; // Per-tower scratch for the parallel targeting pass
+    TickCommands commands;        // Empty between ticks
+    bool endless = false;         // Waves arrive as a far-field horde, see FAR-FIELD SWARM
+    Swarm swarm;
+    float fxBurstScale = 1.0f; int fxSparkOdds = 4; // Cosmetic, from the frontend's quality tier
+
+    uint64_t seed = 1;
+    uint32_t tick = 0;
+    Rng rng, fxRng; // Gameplay draws vs. cosmetic draws (particles), so effects never perturb a replay
+
+    // Sound requests raised during the tick; the frontend plays and clears them.
+    int sfxBlip = 0, sfxBoom = 0, sfxShoot = 0;
+    float lastBossMaxHealth = 0.0f; // Telemetry only; set when the boss is pushed to commands.spawns, not hashed or saved
+
+    GameState() { grid.Init(corePos); }
+};
+
+void ResetGame(GameState& gs, uint64_t seed, bool endless = false) {
+    gs = GameState();
+    gs.endless = endless; gs.seed = seed; gs.rng = Rng(seed); gs.fxRng = Rng(seed ^ 0x9E3779B97F4A7C15ULL);
+}
+
+float WaveSpawnInterval(int wave) { return std::max(0.15f, 1.25f - (wave * 0.06f)); }
+float WaveEnemySpeed(int sides, int wave) { return (180.0f - ((float)sides * 8.0f)) * std::min(1.6f, 1.0f + (wave * 0.035f)); }
+
+// Lays `total` regular enemies out as a horde column `depth` px deep behind the spawn ring,
+// as far-field bands. The swarm must be empty.
+void SpawnHorde(GameState& gs, int total, float depth) {
+    Swarm& sw = gs.swarm;
+    sw.bands.clear(); sw.laneHead.assign(SWARM_LANES, 0); sw.laneEnd.assign(SWARM_LANES, 0);
+    std::fill(std::begin(sw.sectorCount), std::end(sw.sectorCount), 0);
+    sw.clock = 0.0f; sw.count = total; sw.engageTowers = -1;
+
+    const int depthMax = (int)depth, bins = (int)(depthMax / SWARM_BAND_DEPTH) + 1;
+    const int maxSides = std::min(10, 3 + (gs.currentWave / 2));
+    std::vector<int32_t> cells((size_t)SWARM_LANES * bins, 0);
+    for (int i = 0; i < total; i++) {
+        int sector = gs.rng.Range(0, SWARM_SECTORS - 1);
+        int lane = sector * SWARM_SIDE_KINDS + gs.rng.Range(3, maxSides) - 3;
+        cells[(size_t)lane * bins + (int)(gs.rng.Range(0, depthMax) / SWARM_BAND_DEPTH)]++;
+        sw.sectorCount[sector]++;
+    }
+    for (int lane = 0; lane < SWARM_LANES; lane++) {
+        float health = (float)(3 + lane % SWARM_SIDE_KINDS) * 1.2f;
+        sw.laneHead[lane] = (int32_t)sw.bands.size();
+        for (int b = 0; b < bins; b++) if (int32_t n = cells[(size_t)lane * bins + b]) sw.bands.push_back({ SWARM_SPAWN_RADIUS + b * SWARM_BAND_DEPTH, n, n * health });
+        sw.laneEnd[lane] = (int32_t)sw.bands.size();
+    }
+}
+
+// Farthest distance along each sector at which an enemy can be hit or seen: inside the
+// pulse, inside any tower's reach (range plus a Tesla chain), or on the padded screen.
+void UpdateEngageRadius(GameState& gs) {
+    Swarm& sw = gs.swarm;
+    if (sw.engageTowers == gs.towers.Size()) return;
+    sw.engageTowers = gs.towers.Size();
+    const Vector2 c = gs.corePos;
+    const float reach = gs.towerRange + TeslaTower::CHAIN_RADIUS + SWARM_ENEMY_RADIUS;
+    for (int s = 0; s < SWARM_SECTORS; s++) {
+        float best = PULSE_RADIUS + SWARM_ENEMY_RADIUS;
+        for (int k = 0; k <= SWARM_SECTOR_SAMPLES; k++) {
+            float a = (s + (float)k / SWARM_SECTOR_SAMPLES) * SWARM_SECTOR_DEG * DEG2RAD, ux = cosf(a), uy = sinf(a);
+            float ex = ux > 1e-6f ? (SCREEN_WIDTH - c.x + SWARM_VIEW_PAD) / ux : (ux < -1e-6f ? (c.x + SWARM_VIEW_PAD) / -ux : 1e30f);
+            float ey = uy > 1e-6f ? (SCREEN_HEIGHT - c.y + SWARM_VIEW_PAD) / uy : (uy < -1e-6f ? (c.y + SWARM_VIEW_PAD) / -uy : 1e30f);
+            best = std::max(best, std::min(ex, ey));
+            gs.towers.ForEach([&](const auto& bucket) {
+                for (const auto& t : bucket.towers) {
+                    float dx = t.position.x - c.x, dy = t.position.y - c.y, along = dx * ux + dy * uy, perp2 = dx * dx + dy * dy - along * along;
+                    if (perp2 < reach * reach) best = std::max(best, along + sqrtf(reach * reach - perp2));
+                }
+            });
+        }
+        sw.engageRadius[s] = best;
+    }
+}
+
+// Moves the far field and queues every band whose front has reached its sector's engage
+// radius as full enemies, spread evenly over the band's depth and the sector's arc.
+void AdvanceSwarm(GameState& gs, float dt, float moveScale) {
+    Swarm& sw = gs.swarm;
+    if (sw.Empty()) return;
+    UpdateEngageRadius(gs);
+    sw.clock += dt * moveScale;
+    float speed[SWARM_SIDE_KINDS];
+    for (int k = 0; k < SWARM_SIDE_KINDS; k++) speed[k] = WaveEnemySpeed(3 + k, gs.currentWave);
+    for (int lane = 0; lane < SWARM_LANES; lane++) {
+        const int sector = lane / SWARM_SIDE_KINDS, kind = lane % SWARM_SIDE_KINDS;
+        while (sw.laneHead[lane] < sw.laneEnd[lane]) {
+            const SwarmBand& b = sw.bands[sw.laneHead[lane]];
+            float front = b.depth - speed[kind] * sw.clock;
+            if (front > sw.engageRadius[sector]) break;
+            for (int j = 0; j < b.count; j++) {
+                float t = (j + 0.5f) / b.count, angle = (sector + t) * SWARM_SECTOR_DEG * DEG2RAD, dist = front + SWARM_BAND_DEPTH * t;
+                Enemy e; e.position = { gs.corePos.x + cosf(angle) * dist, gs.corePos.y + sinf(angle) * dist };
+                e.radius = SWARM_ENEMY_RADIUS; e.sides = 3 + kind; e.speed = speed[kind];
+                e.maxHealth = (float)e.sides * 1.2f; e.health = b.healthPool / b.count; e.active = true; e.slowTimer = 0;
+                gs.commands.spawns.push_back(e);
+            }
+            sw.count -= b.count; sw.sectorCount[sector] -= b.count; sw.laneHead[lane]++;
+        }
+    }
+}
+
+void StartWave(GameState& gs) {
+    gs.currentWave++; gs.waveActive = true; gs.enemiesToSpawn = 7 + (gs.currentWave * 5);
+    gs.waveIntroTimer = 2.5f;
+    if (gs.currentWave % 10 == 0) gs.bossInQueue = true;
+    if (gs.endless) {
+        // The regular wave's arrival window, packed with more enemies every wave.
+        float depth = gs.enemiesToSpawn * WaveSpawnInterval(gs.currentWave) * WaveEnemySpeed(3, gs.currentWave);
+        int regular = gs.enemiesToSpawn, extra = (int)((int64_t)regular * (gs.currentWave - 1) * (gs.currentWave - 1) / ENDLESS_RAMP);
+        SpawnHorde(gs, regular + extra, depth); gs.enemiesToSpawn = 0;
+    }
+    else gs.commands.ReserveForWave(gs.enemiesToSpawn);
+}
+
+// A regular enemy for the current wave, placed on the spawn ring at a random angle.
+Enemy MakeWaveEnemy(GameState& gs) {
+    float angle = (float)gs.rng.Range(0, 360) * DEG2RAD;
+    Enemy e; e.position = { gs.corePos.x + cosf(angle) * 850.0f, gs.corePos.y + sinf(angle) * 850.0f };
+    e.radius = 22.0f; e.sides = gs.rng.Range(3, std::min(10, 3 + (gs.currentWave / 2)));
+    e.speed = WaveEnemySpeed(e.sides, gs.currentWave);
+    e.maxHealth = (float)e.sides * 1.2f; e.health = e.maxHealth; e.active = true; e.slowTimer = 0;
+    return e;
+}
+
+Enemy MakeBoss(GameState& gs) {
+    float angle = (float)gs.rng.Range(0, 360) * DEG2RAD;
+    Enemy boss; boss.position = { gs.corePos.x+cosf(angle)*850.0f, gs.corePos.y+sinf(angle)*850.0f };
+    boss.sides = 24; boss.radius = 90.0f; boss.maxHealth = 180.0f + ((float)gs.currentWave * 25.0f); boss.health = boss.maxHealth; boss.speed = 25.0f; boss.active = true; boss.slowTimer = 0;
+    return boss;
+}
+
+bool CanBuild(const GameState& gs) { return !gs.waveActive && gs.enemies.Empty(); }
+int GetSlotCost(const GameState& gs) { return 400 + (gs.maxTowers - 3) * 350; }
+int GetFireCost(const GameState& gs) { return 600 + (int)((0.8f - gs.towerFireRate) * 10000); }
+
+bool BuyNodeSlot(GameState& gs) {
+    int slotCost = GetSlotCost(gs);
+    if (gs.currency < slotCost) return false;
+    gs.currency -= slotCost; gs.maxTowers++; gs.sfxBlip++;
+    if (gs.maxTowers == 5 && !gs.cryoUnlocked) { gs.cryoUnlocked = true; gs.pendingCryoNotify = true; }
+    if (gs.maxTowers == 7 && !gs.teslaUnlocked) { gs.teslaUnlocked = true; gs.pendingTeslaNotify = true; }
+    return true;
+}
+
+bool BuyPulseCharge(GameState& gs) {
+    if (gs.currency < 300) return false;
+    gs.currency -= 300; gs.pulseWaveCharges++; gs.sfxBlip++;
+    return true;
+}
+
+bool BuyFireRate(GameState& gs) {
+    int fireCost = GetFireCost(gs);
+    if (gs.currency < fireCost) return false;
+    gs.currency -= fireCost; gs.towerFireRate *= 0.85f; gs.sfxBlip++;
+    return true;
+}
+
+bool BuyCoreRepair(GameState& gs) {
+    if (gs.currency < 450 || gs.coreHealth >= gs.maxCoreHealth) return false;
+    gs.currency -= 450; gs.coreHealth = std::min(gs.coreHealth + 6, gs.maxCoreHealth); gs.sfxBlip++;
+    return true;
+}
+
+void FlushUnlockNotifications(GameState& gs) {
+    if (gs.pendingCryoNotify) {
+        gs.notifications.Add({"CRYO-TECH UNLOCKED!", 5.0f, V_SKYBLUE});
+        gs.notifications.Add({"PRESS [2] TO SELECT", 5.0f, V_WHITE});
+        gs.pendingCryoNotify = false;
+    }
+    if (gs.pendingTeslaNotify) {
+        gs.notifications.Add({"TESLA-TECH UNLOCKED!", 5.0f, V_GOLD});
+        gs.notifications.Add({"PRESS [3] TO SELECT", 5.0f, V_WHITE});
+        gs.pendingTeslaNotify = false;
+    }
+}
+
+void TriggerPulse(GameState& gs) {
+    gs.pulseWaveCharges--; gs.shakeIntensity = 35.0f; gs.pulseVisualRadius = 10.0f; gs.sfxBoom++;
+    gs.notifications.Add({"PULSE DISCHARGED", 2.5f, V_RED});
+    gs.grid.Build(gs.enemies);
+    gs.grid.ForEachInRadius(gs.enemies, gs.corePos, PULSE_RADIUS, [&](int i, float d2) {
+        gs.enemies.health[i] -= (500.0f - sqrtf(d2)) / 5.0f; if(gs.enemies.health[i] <= 0) gs.enemies.active[i] = 0;
+    });
+}
+
+void HandleClick(GameState& gs, Vector2 clickPos) {
+    bool pickedUp = false;
+    for(auto &p : gs.powerups) {
+        if(p.active && GetDistance(clickPos, p.position) < 45) {
+            if(p.type == PWR_EMP) { gs.empTimer = 4.5f; gs.empWaveRadius = 10.0f; gs.notifications.Add({"SYSTEM EMP ACTIVATED", 2.0f, V_PURPLE}); }
+            else if(p.type == PWR_OVERDRIVE) { gs.overdriveTimer = 7.0f; gs.notifications.Add({"LASER OVERDRIVE ONLINE", 2.0f, V_GOLD}); }
+            else if(p.type == PWR_HEAL) {
+                gs.coreHealth = std::min(gs.coreHealth + 3, gs.maxCoreHealth);
+                gs.notifications.Add({"INTEGRITY RESTORED", 2.0f, V_CYAN});
+                for(int i=0; i<80; i++) gs.particles.Spawn({{p.position.x + (float)gs.fxRng.Range(-20,20), p.position.y + (float)gs.fxRng.Range(-20,20)}, {0,0}, V_CYAN, 1.5f, 1.5f, true});
+            }
+            gs.sfxBlip++; p.active = false; pickedUp = true; break;
+        }
+    }
+    if (!pickedUp && gs.towers.Size() < gs.maxTowers && GetDistance(clickPos, gs.corePos) > EXCLUSION_RADIUS) {
+        gs.sfxBlip++; gs.towers.Add(gs.currentSelection, clickPos);
+    }
+}
+
+template <typename P>
+void TargetTowers(const GameState& gs, const std::vector<Tower>& towers, TowerShot* shots, float baseRate) {
+    const float rate = baseRate * P::RATE_SCALE;
+    const EnemyStore& enemies = gs.enemies;
+    jobs.ParallelFor((int)towers.size(), TOWER_CHUNK, [&](int b, int e) {
+        for (int k = b; k < e; k++) {
+            if (towers[k].shootTimer < rate) continue;
+            shots[k].target = gs.grid.Nearest(enemies, towers[k].position, gs.towerRange);
+            if constexpr (P::CHAIN_RADIUS > 0) { if (shots[k].target >= 0) shots[k].chain = gs.grid.Nearest(enemies, enemies.Position(shots[k].target), P::CHAIN_RADIUS, shots[k].target); }
+        }
+    });
+}
+
+template <typename P>
+void FireTowers(GameState& gs, std::vector<Tower>& towers, const TowerShot* shots) {
+    EnemyStore& enemies = gs.enemies;
+    for (size_t k = 0; k < towers.size(); k++) {
+        int ti = shots[k].target;
+        if (ti < 0) continue;
+        Tower& t = towers[k];
+        Vector2 targetPos = enemies.Position(ti);
+        gs.sfxShoot++; gs.shakeIntensity += 1.5f;
+        enemies.health[ti] -= P::DAMAGE; P::OnHit(enemies, ti);
+        gs.lasers.Add({ t.position, targetPos, P::LASER_LIFE, P::Laser() });
+        if constexpr (P::CHAIN_RADIUS > 0) {
+            int si = shots[k].chain;
+            if (si >= 0) { enemies.health[si] -= P::CHAIN_DAMAGE; if (enemies.health[si] <= 0) enemies.active[si] = 0; gs.lasers.Add({ targetPos, enemies.Position(si), P::CHAIN_LASER_LIFE, P::Laser() }); }
+        }
+        if (enemies.health[ti] <= 0) enemies.active[ti] = 0;
+        t.shootTimer = 0;
+    }
+}
+
+// End-of-tick batch: compact removals, then spawns, drops and bursts in record order. The
+// grid is rebuilt if the store changed, so the published state's broad-phase matches its
+// enemies (DrawWorld culls with it).
+void ApplyTickCommands(GameState& gs) {
+    TickCommands& cmd = gs.commands;
+    bool reshaped = gs.enemies.removedCount > 0 || !cmd.spawns.empty();
+    gs.enemies.Compact();
+    for (const Enemy& e : cmd.spawns) gs.enemies.Add(e);
+    for (const PowerUp& p : cmd.drops) gs.powerups.Add(p);
+    for (const ParticleBurst& b : cmd.bursts) SpawnParticleBurst(gs.particles, gs.fxRng, b.pos, b.col, std::max(1, (int)(b.count * gs.fxBurstScale + 0.5f)), b.speed);
+    cmd.Clear();
+    if (reshaped) gs.grid.Build(gs.enemies);
+}
+
+// Advances the GAMEPLAY simulation by dt. Returns false once the core is destroyed.
+// Player input reaches the simulation only through ApplyAction() between ticks.
+bool StepSimulation(GameState& gs, float dt) {
+    Vector2 corePos = gs.corePos;
+    EnemyStore& enemies = gs.enemies;
+    gs.tick++;
+
+    if (gs.waveIntroTimer > 0) gs.waveIntroTimer -= dt;
+
+    if (gs.waveActive && gs.waveIntroTimer <= 0) {
+        ProfileScope scope(PROF_SPAWN);
+        gs.spawnTimer += dt;
+        if (gs.enemiesToSpawn > 0 && gs.spawnTimer > WaveSpawnInterval(gs.currentWave)) {
+            gs.commands.spawns.push_back(MakeWaveEnemy(gs)); gs.enemiesToSpawn--; gs.spawnTimer = 0;
+        } else if (gs.enemiesToSpawn <= 0 && gs.bossInQueue && gs.spawnTimer > 1.8f) {
+            gs.commands.spawns.push_back(MakeBoss(gs)); gs.lastBossMaxHealth = gs.commands.spawns.back().maxHealth; gs.bossInQueue = false; gs.spawnTimer = 0; gs.notifications.Add({"BOSS DETECTED", 3.0f, V_RED});
+        }
+    }
+
+    {
+        ProfileScope scope(PROF_ENEMIES);
+        float moveScale = gs.empTimer <= 0 ? 1.0f : 0.0f;
+        enemies.prevX = enemies.posX; enemies.prevY = enemies.posY;
+        jobs.ParallelFor(enemies.Size(), STEER_CHUNK, [&](int b, int e) { SteerEnemyRange(enemies, b, e, corePos, dt, moveScale); });
+        if (gs.endless) AdvanceSwarm(gs, dt, moveScale); // Engaged bands join at the end of the tick
+
+        gs.grid.Build(enemies);
+        gs.grid.ForEachInRadius(enemies, corePos, CORE_RADIUS, [&](int i, float) {
+            if (enemies.sides[i] == 24) { gs.coreHealth -= 5; gs.shakeIntensity = 45.0f; } else { gs.coreHealth--; gs.shakeIntensity = 18.0f; }
+            gs.damageFlashTimer = 0.18f; enemies.MarkRemove(i);
+        });
+
+        for (int i = 0; i < enemies.Size(); i++) {
+            if (enemies.active[i] || enemies.removed[i]) continue;
+            Vector2 pos = enemies.Position(i);
+            gs.currency += (enemies.sides[i] * 14) + 20; gs.score += (int)(enemies.maxHealth[i] * 100);
+            gs.commands.bursts.push_back({ pos, V_WHITE, 12, 2.0f });
+            if (enemies.sides[i] >= 6) { for(int s=0; s<2; s++) gs.commands.spawns.push_back({pos, 180.0f, 3, 5.0f, 5.0f, true, 16.0f, 0}); }
+            if(gs.rng.Range(1, 100) <= 20) gs.commands.drops.push_back({pos, (PowerType)gs.rng.Range(0, 2), 10.0f, true, 0.0f});
+            enemies.MarkRemove(i);
+        }
+    }
+
+    {
+        ProfileScope scope(PROF_TOWERS);
+        gs.grid.Build(enemies); // Skips entries pending removal, so towers never target them
+        // Timers and sparks run in tower order (they draw from fxRng). Targeting only reads
+        // positions, so it fans out across the job system into per-tower slots; damage is
+        // then applied serially in tower order, matching a single-threaded pass exactly.
+        const float baseRate = (gs.overdriveTimer > 0) ? 0.05f : gs.towerFireRate;
+        gs.towers.ForEach([&](auto& bucket) {
+            for (auto &t : bucket.towers) {
+                t.shootTimer += dt;
+                if (gs.overdriveTimer > 0 && gs.fxSparkOdds >= 0 && gs.fxRng.Range(0, gs.fxSparkOdds) == 0) gs.particles.Spawn({{t.position.x + (float)gs.fxRng.Range(-15,15), t.position.y + (float)gs.fxRng.Range(-15,15)}, {0, -120}, V_GOLD, 0.4f, 0.4f, false});
+            }
+        });
+
+        gs.shots.assign(gs.towers.Size(), TowerShot());
+        int offset = 0;
+        gs.towers.ForEach([&](auto& bucket) { TargetTowers<typename std::decay_t<decltype(bucket)>::Policy>(gs, bucket.towers, gs.shots.data() + offset, baseRate); offset += (int)bucket.towers.size(); });
+        offset = 0;
+        gs.towers.ForEach([&](auto& bucket) { FireTowers<typename std::decay_t<decltype(bucket)>::Policy>(gs, bucket.towers, gs.shots.data() + offset); offset += (int)bucket.towers.size(); });
+    }
+
+    gs.lasers.Sweep([&](Laser& l) { l.lifetime -= dt; return l.lifetime > 0; });
+    gs.powerups.Sweep([&](PowerUp& p) {
+        if (gs.waveActive) { p.timer -= dt; }
+        p.rotation += 120.0f * dt;
+        return p.timer > 0 && p.active;
+    });
+    { ProfileScope scope(PROF_PARTICLES); gs.particles.Update(corePos, dt); }
+    gs.notifications.Sweep([&](Notification& n) { n.timer -= dt; return n.timer > 0; });
+    if (gs.empWaveRadius > 0) { gs.empWaveRadius += 1600.0f * dt; if (gs.empWaveRadius > 2500.0f) { gs.empWaveRadius = 0; } }
+    if (gs.pulseVisualRadius > 0) { gs.pulseVisualRadius += 2200.0f * dt; if (gs.pulseVisualRadius > 1500.0f) { gs.pulseVisualRadius = 0; } }
+    if (gs.empTimer > 0) gs.empTimer -= dt;
+    if (gs.overdriveTimer > 0) gs.overdriveTimer -= dt;
+    if (gs.shakeIntensity > 0) gs.shakeIntensity -= 15.0f * dt;
+    if (gs.damageFlashTimer > 0) gs.damageFlashTimer -= dt;
+
+    ApplyTickCommands(gs);
+    if (gs.waveActive && gs.enemiesToSpawn <= 0 && !gs.bossInQueue && enemies.Empty() && gs.swarm.Empty()) { gs.waveActive = false; gs.towers.Clear(); gs.notifications.Add({"WAVE CLEAR", 2.0f, V_SKYBLUE}); }
+    return gs.coreHealth > 0;
+}
+
+// --- PLAYER ACTIONS & REPLAY ---
+// Every player decision that changes the simulation is an InputEvent stamped with the
+// tick it was applied before. Recording the seed plus these events reproduces a run
+// exactly: replay applies each tick's events, then steps at SIM_DT.
+enum ActionType : uint8_t { ACT_SELECT, ACT_CLICK, ACT_PULSE, ACT_BUY_SLOT, ACT_BUY_PULSE, ACT_BUY_FIRE, ACT_BUY_REPAIR, ACT_CLOSE_ARMORY, ACT_START_WAVE };
+
+struct InputEvent {
+    uint32_t tick;
+    uint8_t type, arg; uint16_t reserved;
+    float x, y;
+};
+
+void ApplyAction(GameState& gs, const InputEvent& ev) {
+    switch (ev.type) {
+        case ACT_SELECT:
+            if (ev.arg == TWR_STANDARD) gs.currentSelection = TWR_STANDARD;
+            if (ev.arg == TWR_CRYO && gs.cryoUnlocked) gs.currentSelection = TWR_CRYO;
+            if (ev.arg == TWR_TESLA && gs.teslaUnlocked) gs.currentSelection = TWR_TESLA;
+            break;
+        case ACT_CLICK: HandleClick(gs, { ev.x, ev.y }); break;
+        case ACT_PULSE: if (gs.pulseWaveCharges > 0 && gs.waveActive) TriggerPulse(gs); break;
+        case ACT_BUY_SLOT: BuyNodeSlot(gs); break;
+        case ACT_BUY_PULSE: BuyPulseCharge(gs); break;
+        case ACT_BUY_FIRE: BuyFireRate(gs); break;
+        case ACT_BUY_REPAIR: BuyCoreRepair(gs); break;
+        case ACT_CLOSE_ARMORY: FlushUnlockNotifications(gs); break;
+        case ACT_START_WAVE: if (CanBuild(gs)) StartWave(gs); break;
+    }
+}
+
+// FNV-1a over the gameplay-relevant state; cosmetics (particles, shake) are excluded.
+uint64_t HashGameState(const GameState& gs) {
+    uint64_t h = 1469598103934665603ULL;
+    auto mix = [&](const void* data, size_t size) { const unsigned char* p = (const unsigned char*)data; for (size_t i = 0; i < size; i++) { h ^= p[i]; h *= 1099511628211ULL; } };
+    int ints[] = { (int)gs.tick, gs.coreHealth, gs.score, gs.currency, gs.currentWave, gs.enemiesToSpawn, gs.maxTowers, gs.pulseWaveCharges, gs.enemies.Size(), gs.towers.Size(), gs.powerups.Size() };
+    mix(ints, sizeof(ints)); mix(&gs.towerFireRate, sizeof(float)); mix(&gs.rng.state, sizeof(uint64_t));
+    if (!gs.enemies.Empty()) { mix(gs.enemies.posX.data(), gs.enemies.Size() * sizeof(float)); mix(gs.enemies.posY.data(), gs.enemies.Size() * sizeof(float)); mix(gs.enemies.health.data(), gs.enemies.Size() * sizeof(float)); }
+    gs.towers.ForEach([&](const auto& bucket) { for (const auto& t : bucket.towers) { mix(&t.position, sizeof(Vector2)); mix(&t.shootTimer, sizeof(float)); } });
+    if (gs.endless) { mix(&gs.swarm.count, sizeof(int)); mix(&gs.swarm.clock, sizeof(float)); }
+    return h;
+}
+
+const uint32_t REPLAY_MAGIC = 0x50524456; // "VDRP"
+const uint32_t REPLAY_VERSION = 4; // 2: towers fire bucketed by type; 3: end-of-tick spawns; 4: flags word (endless)
+const uint32_t REPLAY_ENDLESS = 1;
+
+struct ReplayHeader {
+    uint32_t magic, version;
+    uint64_t seed;
+    uint32_t eventCount, finalTick;
+    int32_t finalScore, finalWave;
+    uint64_t finalHash;
+};
+
+struct InputLog {
+    uint64_t seed = 0;
+    uint32_t flags = 0; // REPLAY_ENDLESS
+    std::vector<InputEvent> events;
+
+    static const size_t EVENT_RESERVE = 4096; // A long session's worth; recording doesn't allocate mid-run below it
+
+    void Begin(uint64_t s, uint32_t f = 0) { seed = s; flags = f; events.clear(); events.reserve(EVENT_RESERVE); }
+
+    // Records the action against the current tick and applies it immediately.
+    void Dispatch(GameState& gs, ActionType type, int arg = 0, Vector2 pos = { 0, 0 }) {
+        InputEvent ev = { gs.tick, (uint8_t)type, (uint8_t)arg, 0, pos.x, pos.y };
+        events.push_back(ev);
+        ApplyAction(gs, ev);
+    }
+
+    bool Save(const char* path, const GameState& gs) const {
+        std::ofstream file(path, std::ios::binary);
+        if (!file) return false;
+        ReplayHeader header = { REPLAY_MAGIC, REPLAY_VERSION, seed, (uint32_t)events.size(), gs.tick, gs.score, gs.currentWave, HashGameState(gs) };
+        file.write((const char*)&header, sizeof(header)); file.write((const char*)&flags, sizeof(flags));
+        if (!events.empty()) file.write((const char*)events.data(), events.size() * sizeof(InputEvent));
+        return (bool)file;
+    }
+
+    bool Load(const char* path, ReplayHeader& header) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.read((char*)&header, sizeof(header)) || header.magic != REPLAY_MAGIC || (header.version != REPLAY_VERSION && header.version != 3)) return false;
+        flags = 0;
+        if (header.version >= 4 && !file.read((char*)&flags, sizeof(flags))) return false;
+        seed = header.seed; events.resize(header.eventCount);
+        return header.eventCount == 0 || (bool)file.read((char*)events.data(), header.eventCount * sizeof(InputEvent));
+    }
+};
+
+// Re-simulates `log` from its seed. Returns the number of ticks stepped.
+uint32_t ReplayLog(GameState& gs, const InputLog& log, uint32_t finalTick) {
+    ResetGame(gs, log.seed, (log.flags & REPLAY_ENDLESS) != 0);
+    size_t next = 0;
+    while (true) {
+        while (next < log.events.size() && log.events[next].tick == gs.tick) ApplyAction(gs, log.events[next++]);
+        if (gs.tick >= finalTick || !StepSimulation(gs, SIM_DT)) break;
+        gs.sfxBlip = gs.sfxBoom = gs.sfxShoot = 0;
+    }
+    return gs.tick;
+}
+
+// --- STATE SNAPSHOTS ---
+// A versioned binary image of the whole gameplay state (everything HashGameState covers plus
+// timers, upgrades, unlocks and both RNG streams), so a run can continue from any tick between
+// ticks. Layout: header, one POD block of scalars, then each container as a raw array.
+// Particles are cosmetic and not saved. Files are read and written with one call each into a
+// flat buffer; the parse is bounds-checked and the stored hash must match after loading.
+const uint32_t STATE_MAGIC = 0x53534456; // "VDSS"
+const uint32_t STATE_VERSION = 2; // 2: endless flag and far-field swarm
+const char* AUTOSAVE_FILE = "autosave.vds";
+
+struct StateHeader {
+    uint32_t magic, version;
+    uint32_t scalarsSize, totalSize;
+    uint32_t enemyCount, towerCounts[TowerSet::BUCKETS], powerupCount, laserCount, notificationCount;
+    uint32_t bandCount, laneCount; // laneCount is 0 or SWARM_LANES
+    uint64_t stateHash; // HashGameState() at save time
+};
+
+struct StateScalars {
+    Vector2 corePos;
+    int32_t coreHealth, maxCoreHealth, score, currency, currentWave, enemiesToSpawn, maxTowers, pulseWaveCharges, currentSelection;
+    float spawnTimer, towerFireRate, towerRange, waveIntroTimer, empTimer, overdriveTimer, empWaveRadius, pulseVisualRadius, shakeIntensity, damageFlashTimer;
+    uint8_t waveActive, bossInQueue, cryoUnlocked, teslaUnlocked, pendingCryoNotify, pendingTeslaNotify, endless, reserved;
+    uint64_t seed, rngState, fxRngState;
+    uint32_t tick;
+    float swarmClock;
+};
+
+size_t StateSnapshotSize(const GameState& gs) {
+    return sizeof(StateHeader) + sizeof(StateScalars) + gs.enemies.Size() * sizeof(Enemy) + gs.towers.Size() * sizeof(Tower)
+         + gs.powerups.Size() * sizeof(PowerUp) + gs.lasers.Size() * sizeof(Laser) + gs.notifications.Size() * sizeof(Notification)
+         + gs.swarm.bands.size() * sizeof(SwarmBand) + gs.swarm.laneHead.size() * 2 * sizeof(int32_t);
+}
+
+// Serializes into `out` (resized, so a buffer with enough capacity never allocates).
+void WriteStateSnapshot(const GameState& gs, std::vector<unsigned char>& out) {
+    out.resize(StateSnapshotSize(gs));
+    unsigned char* p = out.data();
+    auto put = [&](const void* data, size_t size) { if (size) std::memcpy(p, data, size); p += size; };
+
+    StateHeader header = { STATE_MAGIC, STATE_VERSION, (uint32_t)sizeof(StateScalars), (uint32_t)out.size(), (uint32_t)gs.enemies.Size(), {},
+                           (uint32_t)gs.powerups.Size(), (uint32_t)gs.lasers.Size(), (uint32_t)gs.notifications.Size(),
+                           (uint32_t)gs.swarm.bands.size(), (uint32_t)gs.swarm.laneHead.size(), HashGameState(gs) };
+    int b = 0; gs.towers.ForEach([&](const auto& bucket) { header.towerCounts[b++] = (uint32_t)bucket.towers.size(); });
+    StateScalars sc = { gs.corePos, gs.coreHealth, gs.maxCoreHealth, gs.score, gs.currency, gs.currentWave, gs.enemiesToSpawn, gs.maxTowers, gs.pulseWaveCharges, (int32_t)gs.currentSelection,
+                        gs.spawnTimer, gs.towerFireRate, gs.towerRange, gs.waveIntroTimer, gs.empTimer, gs.overdriveTimer, gs.empWaveRadius, gs.pulseVisualRadius, gs.shakeIntensity, gs.damageFlashTimer,
+                        gs.waveActive, gs.bossInQueue, gs.cryoUnlocked, gs.teslaUnlocked, gs.pendingCryoNotify, gs.pendingTeslaNotify, gs.endless, 0,
+                        gs.seed, gs.rng.state, gs.fxRng.state, gs.tick, gs.swarm.clock };
+    put(&header, sizeof(header)); put(&sc, sizeof(sc));
+    for (int i = 0; i < gs.enemies.Size(); i++) { Enemy e = gs.enemies.Get(i); put(&e, sizeof(e)); }
+    gs.towers.ForEach([&](const auto& bucket) { put(bucket.towers.data(), bucket.towers.size() * sizeof(Tower)); });
+    put(gs.powerups.begin(), gs.powerups.Size() * sizeof(PowerUp));
+    put(gs.lasers.begin(), gs.lasers.Size() * sizeof(Laser));
+    put(gs.notifications.begin(), gs.notifications.Size() * sizeof(Notification));
+    put(gs.swarm.bands.data(), gs.swarm.bands.size() * sizeof(SwarmBand));
+    put(gs.swarm.laneHead.data(), gs.swarm.laneHead.size() * sizeof(int32_t)); put(gs.swarm.laneEnd.data(), gs.swarm.laneEnd.size() * sizeof(int32_t));
+}
+
+// Overwrites `gs` with a snapshot. Returns false (leaving `gs` unspecified) on a truncated,
+// foreign or stale-version buffer, or if the restored state doesn't hash as saved.
+bool ReadStateSnapshot(GameState& gs, const unsigned char* data, size_t size) {
+    StateHeader header; StateScalars sc;
+    if (size < sizeof(header)) return false;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != STATE_MAGIC || header.version != STATE_VERSION || header.scalarsSize != sizeof(StateScalars) || header.totalSize > size) return false;
+    if (header.powerupCount > MAX_POWERUPS || header.laserCount > MAX_LASERS || header.notificationCount > MAX_NOTIFICATIONS) return false;
+    if (header.laneCount != 0 && header.laneCount != (uint32_t)SWARM_LANES) return false;
+    uint64_t towerTotal = 0; for (uint32_t n : header.towerCounts) towerTotal += n;
+    uint64_t expected = sizeof(header) + sizeof(sc) + (uint64_t)header.enemyCount * sizeof(Enemy) + towerTotal * sizeof(Tower)
+                      + header.powerupCount * sizeof(PowerUp) + header.laserCount * sizeof(Laser) + header.notificationCount * sizeof(Notification)
+                      + (uint64_t)header.bandCount * sizeof(SwarmBand) + header.laneCount * 2 * sizeof(int32_t);
+    if (expected != header.totalSize) return false;
+
+    const unsigned char* p = data + sizeof(header);
+    auto get = [&](void* out, size_t bytes) { if (bytes) std::memcpy(out, p, bytes); p += bytes; };
+    get(&sc, sizeof(sc));
+    // Reset in place rather than via ResetGame(): a fresh GameState reserves every container,
+    // which costs more than the whole parse.
+    gs.enemies.Clear(); gs.towers.Clear(); gs.particles.Clear(); gs.commands.Clear(); gs.shots.clear();
+    gs.sfxBlip = gs.sfxBoom = gs.sfxShoot = 0; gs.seed = sc.seed;
+    if (sc.corePos.x != gs.corePos.x || sc.corePos.y != gs.corePos.y) { gs.corePos = sc.corePos; gs.grid.Init(gs.corePos); }
+    gs.coreHealth = sc.coreHealth; gs.maxCoreHealth = sc.maxCoreHealth; gs.score = sc.score; gs.currency = sc.currency; gs.currentWave = sc.currentWave; gs.enemiesToSpawn = sc.enemiesToSpawn;
+    gs.maxTowers = sc.maxTowers; gs.pulseWaveCharges = sc.pulseWaveCharges; gs.currentSelection = (TowerType)sc.currentSelection;
+    gs.spawnTimer = sc.spawnTimer; gs.towerFireRate = sc.towerFireRate; gs.towerRange = sc.towerRange; gs.waveIntroTimer = sc.waveIntroTimer; gs.empTimer = sc.empTimer; gs.overdriveTimer = sc.overdriveTimer;
+    gs.empWaveRadius = sc.empWaveRadius; gs.pulseVisualRadius = sc.pulseVisualRadius; gs.shakeIntensity = sc.shakeIntensity; gs.damageFlashTimer = sc.damageFlashTimer;
+    gs.waveActive = sc.waveActive; gs.bossInQueue = sc.bossInQueue; gs.cryoUnlocked = sc.cryoUnlocked; gs.teslaUnlocked = sc.teslaUnlocked; gs.pendingCryoNotify = sc.pendingCryoNotify; gs.pendingTeslaNotify = sc.pendingTeslaNotify;
+    gs.rng.state = sc.rngState; gs.fxRng.state = sc.fxRngState; gs.tick = sc.tick;
+    gs.endless = sc.endless; gs.swarm.clock = sc.swarmClock;
+
+    for (uint32_t i = 0; i < header.enemyCount; i++) { Enemy e; get(&e, sizeof(e)); gs.enemies.Add(e); } // prev = pos, so the first frame doesn't blend from the origin
+    int b = 0;
+    gs.towers.ForEach([&](auto& bucket) { bucket.towers.resize(header.towerCounts[b++]); get(bucket.towers.data(), bucket.towers.size() * sizeof(Tower)); });
+    gs.powerups.count = (int)header.powerupCount; get(gs.powerups.begin(), header.powerupCount * sizeof(PowerUp));
+    gs.lasers.count = (int)header.laserCount; get(gs.lasers.begin(), header.laserCount * sizeof(Laser));
+    gs.notifications.count = (int)header.notificationCount; get(gs.notifications.begin(), header.notificationCount * sizeof(Notification));
+    for (Notification& n : gs.notifications) n.text[sizeof(n.text) - 1] = '\0'; // Not hashed, and the HUD draws these as C strings
+    Swarm& sw = gs.swarm;
+    sw.bands.resize(header.bandCount); get(sw.bands.data(), header.bandCount * sizeof(SwarmBand));
+    sw.laneHead.resize(header.laneCount); sw.laneEnd.resize(header.laneCount);
+    get(sw.laneHead.data(), header.laneCount * sizeof(int32_t)); get(sw.laneEnd.data(), header.laneCount * sizeof(int32_t));
+    sw.count = 0; sw.engageTowers = -1; std::fill(std::begin(sw.sectorCount), std::end(sw.sectorCount), 0);
+    for (uint32_t lane = 0; lane < header.laneCount; lane++) {
+        if (sw.laneHead[lane] < 0 || sw.laneHead[lane] > sw.laneEnd[lane] || sw.laneEnd[lane] > (int32_t)header.bandCount) return false;
+        for (int32_t b = sw.laneHead[lane]; b < sw.laneEnd[lane]; b++) { sw.count += sw.bands[b].count; sw.sectorCount[lane / SWARM_SIDE_KINDS] += sw.bands[b].count; }
+    }
+    gs.commands.ReserveForWave(gs.enemiesToSpawn + gs.enemies.Size());
+    gs.grid.Build(gs.enemies);
+    return HashGameState(gs) == header.stateHash;
+}
+
+// Written through a temp file and rename, like the score file.
+bool SaveStateFile(const char* path, const GameState& gs) {
+    std::vector<unsigned char> buffer; WriteStateSnapshot(gs, buffer);
+    std::string temp = std::string(path) + ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        file.write((const char*)buffer.data(), buffer.size());
+        if (!file.flush()) return false;
+    }
+#if defined(_WIN32)
+    std::remove(path); // rename() doesn't replace an existing file on Windows
+#endif
+    return std::rename(temp.c_str(), path) == 0;
+}
+
+bool LoadStateFile(const char* path, GameState& gs) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+    std::streamoff size = file.tellg();
+    if (size <= 0) return false;
+    std::vector<unsigned char> buffer((size_t)size);
+    file.seekg(0);
+    if (!file.read((char*)buffer.data(), size)) return false;
+    return ReadStateSnapshot(gs, buffer.data(), buffer.size());
+}
+
+// The windowed game's crash-recovery save. The file stays open for the session and is
+// rewritten in place from a reused buffer, so autosaving from the sim thread doesn't touch
+// the heap mid-game. A torn write leaves a header or hash that fails to load.
+struct Autosave {
+    static const uint32_t INTERVAL_TICKS = 600; // Also saved on every wave start and clear
+    std::FILE* file = nullptr;
+    std::vector<unsigned char> buffer;
+    bool invalidated = false;
+
+    void Open() {
+        buffer.reserve(StateSnapshotSize(GameState()) + ENEMY_RESERVE * sizeof(Enemy) + MAX_LASERS * sizeof(Laser));
+        file = std::fopen(AUTOSAVE_FILE, "r+b"); // Keep the previous session's save until the first write
+        if (!file) file = std::fopen(AUTOSAVE_FILE, "w+b");
+        if (file) std::setvbuf(file, nullptr, _IONBF, 0);
+    }
+
+    void Write(const GameState& gs) {
+        if (!file) return;
+        WriteStateSnapshot(gs, buffer);
+        std::fseek(file, 0, SEEK_SET); std::fwrite(buffer.data(), 1, buffer.size(), file);
+        invalidated = false;
+    }
+
+    // Game over: there is nothing to resume. Left as a dead header until the next save.
+    void Invalidate() {
+        if (!file) return;
+        StateHeader dead = {};
+        std::fseek(file, 0, SEEK_SET); std::fwrite(&dead, sizeof(dead), 1, file);
+        invalidated = true;
+    }
+
+    void Close() {
+        if (file) std::fclose(file);
+        file = nullptr;
+        if (invalidated) std::remove(AUTOSAVE_FILE);
+    }
+};
+
+// --- TELEMETRY ---
+// Opt-in (--telemetry [file]) gameplay and performance log for deployed cabinets. The sim
+// thread and the frontend each push fixed-size records into their own lock-free SPSC ring,
+// and a background writer drains both into an append-only binary file. Neither producer
+// ever formats, locks or touches the file. A record that finds its ring full is counted,
+// and the count is logged as one TEL_DROPPED record. Read a log with --telemetry-dump.
+enum TelemetryKind : uint8_t { TEL_SESSION, TEL_WAVE_START, TEL_WAVE_CLEAR, TEL_BOSS_SPAWN, TEL_CORE_HIT, TEL_PULSE, TEL_GAME_OVER, TEL_FRAME_HISTOGRAM, TEL_HIGH_WATER, TEL_DROPPED, TEL_KIND_COUNT };
+
+const char* TELEMETRY_KIND_NAMES[TEL_KIND_COUNT] = { "SESSION", "WAVE_START", "WAVE_CLEAR", "BOSS_SPAWN", "CORE_HIT", "PULSE", "GAME_OVER", "FRAME_HISTOGRAM", "HIGH_WATER", "DROPPED" };
+const char* TELEMETRY_FIELDS[TEL_KIND_COUNT][8] = {
+    { "seed_lo", "seed_hi", "resumed" },
+    { "to_spawn", "towers", "currency", "integrity" },
+    { "score", "currency", "integrity", "ticks" },
+    { "boss_hp", "enemies" },
+    { "damage", "integrity", "enemies" },
+    { "charges_left", "enemies" },
+    { "score", "ticks" },
+    { "<8ms", "<12ms", "<16.7ms", "<20ms", "<25ms", "<33ms", "<50ms", ">=50ms" },
+    { "enemies", "particles", "lasers", "powerups", "worst_us", "enemies_at_worst", "particles_at_worst", "lasers_at_worst" },
+    { "records" },
+};
+const float TELEMETRY_BUCKET_MS[7] = { 8.0f, 12.0f, 16.7f, 20.0f, 25.0f, 33.3f, 50.0f };
+
+const uint32_t TELEMETRY_MAGIC = 0x4C544456; // "VDTL"
+const uint32_t TELEMETRY_VERSION = 1;
+const char* TELEMETRY_FILE = "telemetry.vdt";
+
+struct TelemetryFileHeader { uint32_t magic, version, recordSize; };
+
+struct TelemetryRecord {
+    uint8_t kind, reserved[3];
+    uint32_t timeMs; // Since the writer started
+    uint32_t tick;
+    int32_t wave;
+    int32_t values[8]; // Meaning per kind, see TELEMETRY_FIELDS
+};
+static_assert(sizeof(TelemetryRecord) == 48, "telemetry records are a fixed 48 bytes on disk");
+
+using TelemetryRing = SpscQueue<TelemetryRecord, 1024>;
+
+struct TelemetryWriter {
+    TelemetryRing sim, frontend; // One ring per producer thread
+    std::atomic<uint32_t> dropped{ 0 };
+    std::atomic<bool> stopping{ false };
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::FILE* file = nullptr;
+    char fileBuffer[16384]; // Handed to stdio, so writing never allocates
+    std::thread thread;
+
+    bool Start(const char* path) {
+        file = std::fopen(path, "ab");
+        if (!file) return false;
+        std::setvbuf(file, fileBuffer, _IOFBF, sizeof(fileBuffer));
+        std::fseek(file, 0, SEEK_END);
+        if (std::ftell(file) == 0) { TelemetryFileHeader header = { TELEMETRY_MAGIC, TELEMETRY_VERSION, (uint32_t)sizeof(TelemetryRecord) }; std::fwrite(&header, sizeof(header), 1, file); }
+        thread = std::thread([this] { Loop(); });
+        return true;
+    }
+
+    // Drains what is already queued, then closes the file.
+    void Stop() {
+        if (!file) return;
+        stopping.store(true, std::memory_order_release);
+        thread.join();
+        std::fclose(file); file = nullptr;
+    }
+
+    // Called only by the thread that owns `ring`.
+    void Push(TelemetryRing& ring, TelemetryKind kind, uint32_t tick, int wave, std::initializer_list<int32_t> values) {
+        TelemetryRecord r = {}; r.kind = kind; r.tick = tick; r.wave = wave;
+        r.timeMs = (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        int i = 0; for (int32_t v : values) if (i < 8) r.values[i++] = v;
+        if (!ring.Push(r)) dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Drain() {
+        TelemetryRecord r;
+        while (sim.Pop(r)) std::fwrite(&r, sizeof(r), 1, file);
+        while (frontend.Pop(r)) std::fwrite(&r, sizeof(r), 1, file);
+        if (uint32_t lost = dropped.exchange(0, std::memory_order_relaxed)) {
+            TelemetryRecord d = {}; d.kind = TEL_DROPPED; d.values[0] = (int32_t)lost;
+            std::fwrite(&d, sizeof(d), 1, file);
+        }
+    }
+
+    void Loop() {
+        while (true) {
+            bool last = stopping.load(std::memory_order_acquire);
+            Drain();
+            if (last) break;
+            std::fflush(file);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        std::fflush(file);
+    }
+};
+
+// Turns simulation state changes into telemetry on the sim thread. Observe() runs after
+// every applied action and every tick, so nothing in the gameplay code has to report.
+struct TelemetryWatch {
+    bool waveActive = false, bossInQueue = false;
+    int coreHealth = 0, pulseCharges = 0;
+    uint32_t waveStartTick = 0;
+
+    void Track(const GameState& gs) { waveActive = gs.waveActive; bossInQueue = gs.bossInQueue; coreHealth = gs.coreHealth; pulseCharges = gs.pulseWaveCharges; }
+    void Reset(const GameState& gs) { Track(gs); waveStartTick = gs.tick; }
+
+    void Observe(TelemetryWriter& tw, const GameState& gs) {
+        TelemetryRing& ring = tw.sim;
+        int enemies = gs.enemies.Size();
+        if (!waveActive && gs.waveActive) { waveStartTick = gs.tick; tw.Push(ring, TEL_WAVE_START, gs.tick, gs.currentWave, { gs.enemiesToSpawn, gs.towers.Size(), gs.currency, gs.coreHealth }); }
+        if (bossInQueue && !gs.bossInQueue && gs.waveActive) tw.Push(ring, TEL_BOSS_SPAWN, gs.tick, gs.currentWave, { (int32_t)gs.lastBossMaxHealth, enemies });
+        if (gs.coreHealth < coreHealth) tw.Push(ring, TEL_CORE_HIT, gs.tick, gs.currentWave, { coreHealth - gs.coreHealth, gs.coreHealth, enemies });
+        if (gs.pulseWaveCharges < pulseCharges) tw.Push(ring, TEL_PULSE, gs.tick, gs.currentWave, { gs.pulseWaveCharges, enemies });
+        if (waveActive && !gs.waveActive && gs.coreHealth > 0) tw.Push(ring, TEL_WAVE_CLEAR, gs.tick, gs.currentWave, { gs.score, gs.currency, gs.coreHealth, (int32_t)(gs.tick - waveStartTick) });
+        if (coreHealth > 0 && gs.coreHealth <= 0) tw.Push(ring, TEL_GAME_OVER, gs.tick, gs.currentWave, { gs.score, (int32_t)gs.tick });
+        Track(gs);
+    }
+};
+
+// Frame-time histogram and entity high-water marks over each wave's GAMEPLAY frames, built
+// on the main thread from the profiler's records and pushed once the wave is over.
+struct FrameTelemetry {
+    int wave = 0; uint32_t tick = 0;
+    int32_t buckets[8] = {}, frames = 0, maxEnemies = 0, maxParticles = 0, maxLasers = 0, maxPowerups = 0;
+    FrameRecord worst = {};
+
+    void Add(TelemetryWriter& tw, const FrameRecord& r, int powerups, int currentWave, uint32_t currentTick) {
+        if (currentWave != wave) Flush(tw);
+        wave = currentWave; tick = currentTick;
+        int b = 0; while (b < 7 && r.frameMs >= TELEMETRY_BUCKET_MS[b]) b++;
+        buckets[b]++; frames++;
+        maxEnemies = std::max(maxEnemies, r.enemies); maxParticles = std::max(maxParticles, r.particles); maxLasers = std::max(maxLasers, r.lasers); maxPowerups = std::max(maxPowerups, powerups);
+        if (r.frameMs > worst.frameMs) worst = r;
+    }
+
+    void Flush(TelemetryWriter& tw) {
+        if (frames == 0) return;
+        const int32_t* h = buckets;
+        tw.Push(tw.frontend, TEL_FRAME_HISTOGRAM, tick, wave, { h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7] });
+        tw.Push(tw.frontend, TEL_HIGH_WATER, tick, wave, { maxEnemies, maxParticles, maxLasers, maxPowerups, (int32_t)(worst.frameMs * 1000.0f), worst.enemies, worst.particles, worst.lasers });
+        *this = FrameTelemetry();
+    }
+};
+
+// Usage: vector-defense --telemetry-dump <file>. One line per record.
+int RunTelemetryDump(const char* path) {
+    std::ifstream file(path, std::ios::binary);
+    TelemetryFileHeader header;
+    if (!file.read((char*)&header, sizeof(header)) || header.magic != TELEMETRY_MAGIC || header.version != TELEMETRY_VERSION || header.recordSize != sizeof(TelemetryRecord)) {
+        std::cerr << "not a telemetry log: " << path << "\n"; return 1;
+    }
+    TelemetryRecord r; int count = 0;
+    while (file.read((char*)&r, sizeof(r))) {
+        if (r.kind >= TEL_KIND_COUNT) { std::cerr << "corrupt record " << count << "\n"; return 1; }
+        std::cout << TextFormat("%10.3fs  tick %7u  wave %3d  %-15s", r.timeMs / 1000.0, r.tick, r.wave, TELEMETRY_KIND_NAMES[r.kind]);
+        for (int i = 0; i < 8 && TELEMETRY_FIELDS[r.kind][i]; i++) std::cout << " " << TELEMETRY_FIELDS[r.kind][i] << "=" << r.values[i];
+        std::cout << "\n"; count++;
+    }
+    std::cout << count << " records\n";
+    return 0;
+}
+
+// --- SIMULATION THREAD ---
+// The windowed game simulates on its own thread at a fixed SIM_DT. After every batch of
+// ticks it copies the whole GameState into a triple-buffered snapshot, which the render
+// thread draws without ever blocking it. Player input travels the other way as SimCommands
+// and is stamped with the tick it lands on, so the recorded session still replays exactly.
+// A command wakes the thread, so it is applied and published at once rather than with the
+// next tick.
+struct SimCommand {
+    bool reset;    // Start a new game with `seed` instead of applying an action
+    uint64_t seed;
+    ActionType action; int arg; Vector2 pos;
+};
+
+struct SimSnapshot {
+    GameState state;
+    uint32_t generation = 0; // Bumped by every reset, so the frontend can skip pre-reset frames
+    double tickTime = 0.0;   // SimClock() when state.tick was simulated; drives render interpolation
+    uint32_t commands = 0;   // Commands applied so far, compared against SimThread::commandsSent
+};
+
+double SimClock() { return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+
+// How far (0..1) the frontend is between the snapshot's tick and the next one.
+float InterpolationAlpha(const SimSnapshot& snap) { return std::clamp((float)((SimClock() - snap.tickTime) / SIM_DT), 0.0f, 1.0f); }
+
+struct SimThread {
+    GameState gs;
+    InputLog session;
+    bool recording = true; // False for a resumed run: its start state isn't a seed, so it can't be replayed
+    Autosave autosave;
+    bool autosavedWave = false; uint32_t autosavedTick = 0;
+    uint32_t generation = 0;
+    double lastTickTime = 0.0;
+    TelemetryWriter* telemetry = nullptr; // Optional; set before Start()
+    bool endless = false;                 // Mode for new games; a resumed state keeps its own
+    TelemetryWatch watch;
+    TripleBuffer<SimSnapshot> snapshots;
+    SpscQueue<SimCommand, 256> commands;
+    std::atomic<bool> running{ false }, quit{ false };
+    std::atomic<int> sfxBlip{ 0 }, sfxBoom{ 0 }, sfxShoot{ 0 }; // Drained by the frontend each frame
+    std::atomic<int> qualityTier{ QUALITY_FULL }; // Set by the frontend's governor
+    std::mutex wakeLock; std::condition_variable wake;
+    uint32_t commandsSent = 0, commandsApplied = 0; // Frontend and sim side respectively
+    std::thread thread;
+    static constexpr double LATCH_TIMEOUT = 0.002;
+
+    // Starts from `resume` when given (a loaded snapshot), otherwise a new game from `seed`.
+    void Start(uint64_t seed, const GameState* resume = nullptr) {
+        if (resume) { gs = *resume; recording = false; } else ResetGame(gs, seed, endless);
+        session.Begin(gs.seed, gs.endless ? REPLAY_ENDLESS : 0); autosave.Open();
+        autosavedWave = gs.waveActive; autosavedTick = gs.tick;
+        BeginTelemetry(!recording);
+        Publish();
+        thread = std::thread([this] { Loop(); });
+    }
+
+    // Joins the thread and records an unfinished session, mirroring the game-over save; the
+    // autosave then holds the exact state quit on, so --resume continues from it.
+    void Stop() {
+        quit = true; Wake();
+        if (thread.joinable()) thread.join();
+        if (gs.coreHealth > 0 && gs.tick > 0) { if (recording) session.Save("last_session.vdr", gs); autosave.Write(gs); }
+        autosave.Close();
+    }
+
+    void BeginTelemetry(bool resumed) {
+        if (!telemetry) return;
+        watch.Reset(gs);
+        telemetry->Push(telemetry->sim, TEL_SESSION, gs.tick, gs.currentWave, { (int32_t)(uint32_t)gs.seed, (int32_t)(uint32_t)(gs.seed >> 32), resumed ? 1 : 0 });
+    }
+    void ObserveTelemetry() { if (telemetry) watch.Observe(*telemetry, gs); }
+
+    void AutosaveIfDue() {
+        if (gs.waveActive == autosavedWave && gs.tick < autosavedTick + Autosave::INTERVAL_TICKS) return;
+        autosave.Write(gs); autosavedWave = gs.waveActive; autosavedTick = gs.tick;
+    }
+
+    void Send(ActionType action, int arg = 0, Vector2 pos = { 0, 0 }) { if (commands.Push({ false, 0, action, arg, pos })) { commandsSent++; Wake(); } }
+    void Reset(uint64_t seed) { if (commands.Push({ true, seed, ACT_SELECT, 0, { 0, 0 } })) { commandsSent++; Wake(); } }
+    // Taking the lock orders the notify after the loop's emptiness check, so no wake is lost.
+    void Wake() { { std::lock_guard<std::mutex> lk(wakeLock); } wake.notify_one(); }
+
+    // The newest snapshot, after waiting up to LATCH_TIMEOUT for it to include every command
+    // sent so far, so a frame that sends input can already draw its result. Like Front(), it
+    // invalidates any snapshot reference taken before.
+    const SimSnapshot& LatchSnapshot() {
+        const SimSnapshot* snap = &snapshots.Front();
+        double deadline = SimClock() + LATCH_TIMEOUT;
+        while ((int32_t)(snap->commands - commandsSent) < 0 && SimClock() < deadline) { std::this_thread::yield(); snap = &snapshots.Front(); }
+        return *snap;
+    }
+
+    void Publish() {
+        sfxBlip += gs.sfxBlip; sfxBoom += gs.sfxBoom; sfxShoot += gs.sfxShoot;
+        gs.sfxBlip = gs.sfxBoom = gs.sfxShoot = 0;
+        SimSnapshot& snap = snapshots.Back();
+        snap.state = gs; snap.generation = generation; snap.tickTime = lastTickTime; snap.commands = commandsApplied;
+        snapshots.Publish();
+    }
+
+    void Loop() {
+        auto last = std::chrono::steady_clock::now();
+        double accumulator = 0.0;
+        while (!quit) {
+            bool dirty = false;
+            SimCommand cmd;
+            while (commands.Pop(cmd)) {
+                if (cmd.reset) { ResetGame(gs, cmd.seed, endless); session.Begin(cmd.seed, endless ? REPLAY_ENDLESS : 0); recording = true; generation++; accumulator = 0.0; autosavedWave = false; autosavedTick = 0; BeginTelemetry(false); }
+                else { session.Dispatch(gs, cmd.action, cmd.arg, cmd.pos); ObserveTelemetry(); }
+                commandsApplied++; dirty = true;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double>(now - last).count(); last = now;
+            if (running && gs.coreHealth > 0) {
+                accumulator += std::min(elapsed, 0.25);
+                const QualitySettings& q = QUALITY_TIERS[qualityTier.load(std::memory_order_relaxed)];
+                gs.fxBurstScale = q.burstScale; gs.fxSparkOdds = q.sparkOdds;
+                while (accumulator >= SIM_DT) {
+                    accumulator -= SIM_DT; dirty = true;
+                    bool alive = StepSimulation(gs, SIM_DT); lastTickTime = SimClock(); ObserveTelemetry();
+                    if (!alive) { if (recording) session.Save("last_session.vdr", gs); autosave.Invalidate(); accumulator = 0.0; break; }
+                }
+            } else accumulator = 0.0;
+
+            if (gs.coreHealth > 0) AutosaveIfDue();
+            if (dirty) Publish();
+            std::unique_lock<std::mutex> lk(wakeLock);
+            wake.wait_for(lk, std::chrono::duration<double>(std::max(0.0005, SIM_DT - accumulator)), [this] { return quit || !commands.Empty(); });
+        }
+    }
+};
+
+// --- INPUT ---
+// Everything a frame reads from the keyboard and mouse, latched before the update phase.
+// Presses accumulate across polls, so the frame-delay wait can poll again after the one in
+// EndDrawing() without dropping a press that poll saw.
+struct FrameInput {
+    static constexpr int KEYS[] = { KEY_F2, KEY_F3, KEY_F4, KEY_F5, KEY_F6, KEY_F7, KEY_ESCAPE, KEY_P, KEY_ENTER, KEY_BACKSPACE, KEY_SPACE, KEY_U, KEY_ONE, KEY_TWO, KEY_THREE };
+    static constexpr int KEY_COUNT = sizeof(KEYS) / sizeof(KEYS[0]);
+    uint32_t keys = 0;
+    bool click = false;
+    Vector2 mouse = { 0, 0 }, clickPos = { 0, 0 };
+    int chars[16] = {}; int charCount = 0;
+    double sampleTime = 0.0; // SimClock() of the poll that saw the first press; 0 = none
+
+    void Latch(double pollTime) {
+        bool fresh = false;
+        for (int k = 0; k < KEY_COUNT; k++) if (!(keys & (1u << k)) && IsKeyPressed(KEYS[k])) { keys |= 1u << k; fresh = true; }
+        mouse = GetMousePosition();
+        if (!click && IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) { click = true; clickPos = mouse; fresh = true; }
+        for (int c = GetCharPressed(); c > 0; c = GetCharPressed()) if (charCount < 16) { chars[charCount++] = c; fresh = true; }
+        if (fresh && sampleTime == 0.0) sampleTime = pollTime;
+    }
+    bool Pressed(int key) const { for (int k = 0; k < KEY_COUNT; k++) if (KEYS[k] == key) return keys & (1u << k); return false; }
+    bool Clicked(Rectangle bounds) const { return click && CheckCollisionPointRec(clickPos, bounds); }
+};
+
+// Input-to-present latency: from the poll that saw an input to the end of the present of the
+// first frame showing its effect. For a sim action that is the first frame drawn from a
+// snapshot that has applied it. One input is tracked at a time.
+struct InputLatency {
+    bool pending = false;
+    double sampleTime = 0.0;
+    uint32_t command = 0;
+
+    void Begin(double sample, uint32_t commandsSent) { if (pending || sample == 0.0) return; pending = true; sampleTime = sample; command = commandsSent; }
+    // Milliseconds once the presented snapshot has applied the pending input, else 0.
+    float Presented(double presentTime, uint32_t commandsApplied) {
+        if (!pending || (int32_t)(commandsApplied - command) < 0) return 0.0f;
+        pending = false; return (float)((presentTime - sampleTime) * 1000.0);
+    }
+};
+
+// --- FRAME PACING ---
+// raylib's frame cap waits right after EndDrawing() polls input, so a frame acts on input
+// as old as the wait. --frame-delay moves that wait to the start of the frame and polls
+// again after it, leaving only the frame's own busy time between sampling and present. With
+// a cap, frames start on a fixed grid and wait `delay` into their slot; with --vsync or
+// --uncapped the slot starts when the previous present returns.
+struct FramePacer {
+    static constexpr int WINDOW = 30;            // Frames of busy time the auto delay must cover
+    static constexpr double MARGIN = 0.002;  // Headroom left before the slot ends, s
+    bool enabled = false, autoDelay = false, capped = false;
+    double period = 0.0, delay = 0.0, slot = 0.0; // Seconds
+
+    // Auto delay: the slot minus the slowest recent busy time (frame minus present).
+    void Adapt(const FrameProfiler& p) {
+        if (!autoDelay) return;
+        float busyMs = 0.0f;
+        for (int i = 0; i < std::min(WINDOW, p.filled); i++) busyMs = std::max(busyMs, p.Recent(i).frameMs - p.Recent(i).stageMs[PROF_PRESENT]);
+        delay = std::clamp(period - busyMs * 1e-3 - MARGIN, 0.0, period * 0.75);
+    }
+
+    void Wait() {
+        double now = SimClock();
+        if (capped) { slot += period; if (slot + delay < now) slot = now - delay; } else slot = now;
+        double target = slot + delay;
+        if (target - now > 0.001) std::this_thread::sleep_for(std::chrono::duration<double>(target - now - 0.001));
+        while (SimClock() < target) std::this_thread::yield();
+    }
+};
+
+// --- RENDER SCALING ---
+// Gameplay and layout use a fixed SCREEN_WIDTH x SCREEN_HEIGHT canvas, letterboxed into the
+// window at `canvasZoom` window points per unit. The HUD is drawn straight to the window
+// through HudCamera(), so text and panels are rasterized at native resolution. The world
+// goes into `target` at `scale` times the canvas's native pixel size; the bloom composite
+// then stretches it over the canvas. `scale` is the manual setting ([F6]/[F7],
+// --render-scale) capped by the governor's tier. Window and DPI changes are picked up each
+// frame and only reallocate render targets.
+struct RenderScaler {
+    static constexpr float STEPS[] = { 0.5f, 0.6f, 0.7f, 0.85f, 1.0f, 1.5f, 2.0f };
+    static constexpr int STEP_COUNT = sizeof(STEPS) / sizeof(STEPS[0]);
+    float manual = 1.0f, scale = 1.0f;
+    float canvasZoom = 1.0f, pixelsPerPoint = 1.0f;
+    Rectangle viewport = { 0, 0, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT }; // Canvas in window points
+    RenderTexture2D target = {};
+
+    void Update(float cap) {
+        int w = GetScreenWidth(), h = GetScreenHeight();
+        if (w <= 0 || h <= 0) { w = SCREEN_WIDTH; h = SCREEN_HEIGHT; }
+        pixelsPerPoint = (GetRenderWidth() > 0) ? (float)GetRenderWidth() / w : 1.0f;
+        canvasZoom = std::min((float)w / SCREEN_WIDTH, (float)h / SCREEN_HEIGHT);
+        Rectangle vp = { floorf((w - SCREEN_WIDTH * canvasZoom) / 2), floorf((h - SCREEN_HEIGHT * canvasZoom) / 2), SCREEN_WIDTH * canvasZoom, SCREEN_HEIGHT * canvasZoom };
+        if (vp.x != viewport.x || vp.y != viewport.y || vp.width != viewport.width || vp.height != viewport.height) {
+            viewport = vp;
+            SetMouseOffset(-(int)vp.x, -(int)vp.y); SetMouseScale(1.0f / canvasZoom, 1.0f / canvasZoom); // GetMousePosition() in canvas units
+        }
+        scale = std::min(manual, cap);
+        int tw = std::max(1, (int)roundf(vp.width * pixelsPerPoint * scale)), th = std::max(1, (int)roundf(vp.height * pixelsPerPoint * scale));
+        if (target.id != 0 && target.texture.width == tw && target.texture.height == th) return;
+        if (target.id != 0) UnloadRenderTexture(target);
+        target = LoadRenderTexture(tw, th); SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    void Step(int dir) {
+        int i = 0;
+        while (i + 1 < STEP_COUNT && STEPS[i] < manual - 0.01f) i++;
+        manual = STEPS[std::clamp(i + dir, 0, STEP_COUNT - 1)];
+    }
+
+    float NativeScale() const { return canvasZoom * pixelsPerPoint; }               // Framebuffer pixels per canvas unit
+    float WorldZoom() const { return (float)target.texture.width / SCREEN_WIDTH; }  // Target pixels per canvas unit
+    Camera2D HudCamera() const { return { { viewport.x, viewport.y }, { 0, 0 }, 0.0f, canvasZoom }; }
+    void Unload() { if (target.id != 0) UnloadRenderTexture(target); target = RenderTexture2D{ 0 }; }
+};
+
+// --- WORLD RENDERER ---
+void DrawBackgroundGrid() {
+    for(int i = -100; i < SCREEN_WIDTH + 100; i += 64) DrawLine(i, -100, i, SCREEN_HEIGHT + 100, {30, 30, 35, 255});
+    for(int i = -100; i < SCREEN_HEIGHT + 100; i += 64) DrawLine(-100, i, SCREEN_WIDTH + 100, i, {30, 30, 35, 255});
+}
+
+// Grid, core rings and tower range rings: the parts of the world that only change when a
+// tower is placed or the wave clears.
+void DrawStaticWorld(const GameState& gs, bool showCore, bool showRanges) {
+    const Vector2 corePos = gs.corePos;
+    DrawBackgroundGrid();
+    if (showCore) {
+        DrawCircleLines((int)corePos.x, (int)corePos.y, EXCLUSION_RADIUS, ColorAlpha(V_RED, 0.3f));
+        DrawCircleLines((int)corePos.x, (int)corePos.y, CORE_RADIUS, V_CYAN);
+        DrawCircle((int)corePos.x, (int)corePos.y, 4, V_WHITE);
+    }
+    if (showRanges) gs.towers.ForEach([&](const auto& bucket) { for (const auto& t : bucket.towers) DrawCircleLines((int)t.position.x, (int)t.position.y, gs.towerRange, ColorAlpha(V_WHITE, 0.1f)); });
+}
+
+// DrawStaticWorld() cached in an opaque texture that replaces the per-frame clear. It spans
+// the grid's 100 px overscan so drawing it inside BeginMode2D moves it with the camera shake.
+// It is painted at the world target's resolution (`scale` pixels per world unit).
+struct StaticLayer {
+    static const int MARGIN = 100;
+    RenderTexture2D target = {};
+    uint64_t key = 0;
+    float scale = 1.0f;
+    bool loaded = false, valid = false;
+
+    static uint64_t Key(const GameState& gs, bool showCore, bool showRanges) {
+        uint64_t h = 1469598103934665603ULL;
+        auto mix = [&](const void* data, size_t size) { const unsigned char* p = (const unsigned char*)data; for (size_t i = 0; i < size; i++) { h ^= p[i]; h *= 1099511628211ULL; } };
+        mix(&showCore, sizeof(showCore)); mix(&showRanges, sizeof(showRanges)); mix(&gs.towerRange, sizeof(float));
+        if (showRanges) gs.towers.ForEach([&](const auto& bucket) { for (const auto& t : bucket.towers) mix(&t.position, sizeof(Vector2)); });
+        return h;
+    }
+
+    // Must run outside any other BeginTextureMode() pass.
+    void Update(const GameState& gs, bool showCore, bool showRanges, float pixelScale = 1.0f) {
+        uint64_t k = Key(gs, showCore, showRanges);
+        if (loaded && pixelScale != scale) { UnloadRenderTexture(target); loaded = valid = false; }
+        if (valid && k == key) return;
+        if (!loaded) { scale = pixelScale; target = LoadRenderTexture((int)roundf((SCREEN_WIDTH + 2 * MARGIN) * scale), (int)roundf((SCREEN_HEIGHT + 2 * MARGIN) * scale)); loaded = true; }
+        BeginTextureMode(target);
+            ClearBackground(V_BLACK);
+            rlPushMatrix(); rlScalef(scale, scale, 1.0f); rlTranslatef((float)MARGIN, (float)MARGIN, 0.0f);
+            DrawStaticWorld(gs, showCore, showRanges);
+            rlPopMatrix();
+        EndTextureMode();
+        key = k; valid = true;
+    }
+
+    void Draw() const { DrawTexturePro(target.texture, { 0, 0, (float)target.texture.width, -(float)target.texture.height }, { (float)-MARGIN, (float)-MARGIN, (float)(SCREEN_WIDTH + 2 * MARGIN), (float)(SCREEN_HEIGHT + 2 * MARGIN) }, { 0, 0 }, 0.0f, WHITE); }
+    void Unload() { if (loaded) UnloadRenderTexture(target); loaded = valid = false; }
+};
+
+// Endless mode: one marker per occupied far-field sector on the screen edge, sized by the
+// sector's count. Screen space, drawn with the HUD.
+void DrawSwarmMarkers(const GameState& gs) {
+    if (gs.swarm.Empty()) return;
+    const float inset = 14.0f;
+    for (int s = 0; s < SWARM_SECTORS; s++) {
+        int n = gs.swarm.sectorCount[s];
+        if (n <= 0) continue;
+        float a = (s + 0.5f) * SWARM_SECTOR_DEG * DEG2RAD, ux = cosf(a), uy = sinf(a);
+        float ex = fabsf(ux) > 1e-6f ? ((ux > 0 ? SCREEN_WIDTH - gs.corePos.x : gs.corePos.x) - inset) / fabsf(ux) : 1e30f;
+        float ey = fabsf(uy) > 1e-6f ? ((uy > 0 ? SCREEN_HEIGHT - gs.corePos.y : gs.corePos.y) - inset) / fabsf(uy) : 1e30f;
+        float d = std::min(ex, ey);
+        DrawCircleV({ gs.corePos.x + ux * d, gs.corePos.y + uy * d }, 2.0f + log2f((float)n), ColorAlpha(V_RED, 0.55f));
+    }
+}
+
+// World-space rectangle a camera sees (no rotation), widened by `slack` on every side.
+struct ViewBounds {
+    float x0, y0, x1, y1;
+    bool Circle(Vector2 c, float r) const { return c.x + r >= x0 && c.x - r <= x1 && c.y + r >= y0 && c.y - r <= y1; }
+    bool Segment(Vector2 a, Vector2 b, float r) const { return std::max(a.x, b.x) + r >= x0 && std::min(a.x, b.x) - r <= x1 && std::max(a.y, b.y) + r >= y0 && std::min(a.y, b.y) - r <= y1; }
+};
+
+// `viewW`/`viewH` is the size of the surface the camera draws into, in pixels.
+ViewBounds CameraView(const Camera2D& camera, float slack, float viewW = SCREEN_WIDTH, float viewH = SCREEN_HEIGHT) {
+    float zoom = camera.zoom != 0.0f ? camera.zoom : 1.0f;
+    float x0 = camera.target.x - camera.offset.x / zoom, y0 = camera.target.y - camera.offset.y / zoom;
+    return { x0 - slack, y0 - slack, x0 + viewW / zoom + slack, y0 + viewH / zoom + slack };
+}
+
+// Tallest enemy (the boss) plus outline width; the grid query is padded by this much.
+const float ENEMY_CULL_PAD = 96.0f;
+
+// Draws the dynamic simulation entities that intersect `view`, on top of the StaticLayer.
+// Enemies and particles are drawn `alpha` of the way from their previous tick to this one;
+// lasers are fixed segments captured when the shot fired, so they need no blending.
+// Enemies come from the snapshot's spatial grid (built after the tick's last move), so
+// off-screen cells of the spawn ring are never visited. Polygons are queued on `polys`;
+// the caller flushes.
+void DrawWorld(const GameState& gs, PolyBatch& polys, const ViewBounds& view, const QualitySettings& quality, float alpha) {
+    const Vector2 corePos = gs.corePos;
+    const EnemyStore& enemies = gs.enemies;
+    DrawParticles(gs.particles, alpha, view.x0, view.y0, view.x1, view.y1);
+    if (gs.empWaveRadius > 0) DrawCircleLines((int)corePos.x, (int)corePos.y, gs.empWaveRadius, ColorAlpha(V_PURPLE, 1.0f - (gs.empWaveRadius/2500.0f)));
+    if (gs.pulseVisualRadius > 0) DrawRing(corePos, gs.pulseVisualRadius - 15.0f, gs.pulseVisualRadius, 0, 360, quality.ringSegments, ColorAlpha(V_RED, 1.0f - (gs.pulseVisualRadius/1500.0f)));
+    for (const auto& l : gs.lasers) if (view.Segment(l.start, l.end, 2.0f)) DrawLineEx(l.start, l.end, 3.0f, l.col);
+    for (const auto& p : gs.powerups) if (view.Circle(p.position, 26.0f)) polys.Add({p.position.x, p.position.y + sinf(GetTime()*5)*5}, 4, 18, p.rotation, 2, BLANK, (p.type == PWR_EMP ? V_PURPLE : (p.type == PWR_OVERDRIVE ? V_GOLD : V_CYAN)));
+    gs.towers.ForEach([&](const auto& bucket) {
+        using P = typename std::decay_t<decltype(bucket)>::Policy;
+        for (const auto& t : bucket.towers) if (view.Circle(t.position, 20.0f)) polys.AddHealthBody(t.position, P::SIDES, 18, 1.0f, P::Body());
+    });
+    auto drawEnemy = [&](int i) {
+        Vector2 pos = enemies.Interpolated(i, alpha);
+        if (!view.Circle(pos, enemies.radius[i] + 2.0f)) return;
+        polys.AddHealthBody(pos, enemies.sides[i], enemies.radius[i], enemies.health[i]/enemies.maxHealth[i], enemies.slowTimer[i] > 0 ? V_SKYBLUE : V_RED);
+    };
+    if (gs.grid.Covers(enemies)) gs.grid.ForEachInCells(view.x0 - ENEMY_CULL_PAD, view.y0 - ENEMY_CULL_PAD, view.x1 + ENEMY_CULL_PAD, view.y1 + ENEMY_CULL_PAD, drawEnemy);
+    else for (int i = 0; i < enemies.Size(); i++) drawEnemy(i);
+}
+
+// --- HEADLESS RUNNER ---
+// Plays a scripted game with no window or audio device at a fixed SIM_DT, as fast
+// as the CPU allows. Usage: vector-defense --headless [waves] [seed] [record.vdr]
+// Alternates the unlocked node types on a ring of `radius` around the core.
+void PlaceTowerRing(GameState& gs, InputLog& log, float radius) {
+    TowerType types[3] = { TWR_STANDARD }; int typeCount = 1;
+    if (gs.cryoUnlocked) types[typeCount++] = TWR_CRYO;
+    if (gs.teslaUnlocked) types[typeCount++] = TWR_TESLA;
+    for (int i = 0; i < gs.maxTowers; i++) {
+        float angle = (360.0f / gs.maxTowers) * i * DEG2RAD;
+        log.Dispatch(gs, ACT_SELECT, types[i % typeCount]);
+        log.Dispatch(gs, ACT_CLICK, 0, { gs.corePos.x + cosf(angle) * radius, gs.corePos.y + sinf(angle) * radius });
+    }
+}
+
+void AutoBuildPhase(GameState& gs, InputLog& log) {
+    while (GetSlotCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_SLOT);
+    if (gs.pulseWaveCharges < 2 && gs.currency >= 300) log.Dispatch(gs, ACT_BUY_PULSE);
+    while (GetFireCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_FIRE);
+    if (gs.currency >= 450 && gs.coreHealth < gs.maxCoreHealth) log.Dispatch(gs, ACT_BUY_REPAIR);
+    log.Dispatch(gs, ACT_CLOSE_ARMORY);
+    PlaceTowerRing(gs, log, 140.0f); // Just outside the core's exclusion ring, well inside tower range
+}
+
+// Steps one started wave to its end, firing a pulse whenever an enemy closes within 150 px.
+// Returns false if the core fell.
+bool PlayScriptedWave(GameState& gs, InputLog& log) {
+    bool alive = true;
+    while (alive && (gs.waveActive || !gs.enemies.Empty())) {
+        if (gs.pulseWaveCharges > 0) {
+            for (int i = 0; i < gs.enemies.Size(); i++) if (GetDistance(gs.enemies.Position(i), gs.corePos) < 150.0f) { log.Dispatch(gs, ACT_PULSE); break; }
+        }
+        alive = StepSimulation(gs, SIM_DT);
+        gs.sfxBlip = gs.sfxBoom = gs.sfxShoot = 0;
+    }
+    return alive;
+}
+
+void PrintRunSummary(const GameState& gs, double wall) {
+    double simSeconds = gs.tick * (double)SIM_DT;
+    std::cout << "waves reached: " << gs.currentWave << (gs.coreHealth > 0 ? " (survived)" : " (core destroyed)") << "\n"
+              << "score: " << gs.score << "  integrity: " << gs.coreHealth << "/" << gs.maxCoreHealth << "  state hash: " << std::hex << HashGameState(gs) << std::dec << "\n"
+              << "ticks: " << gs.tick << "  sim time: " << simSeconds << "s  wall time: " << wall << "s  speedup: " << (wall > 0 ? simSeconds / wall : 0.0) << "x\n";
+}
+
+// Writes `gs` to `path` and reads it back, reporting both times; used to capture late-game
+// states for --bench --from and --resume.
+bool CaptureState(const char* path, const GameState& gs) {
+    auto t0 = std::chrono::steady_clock::now();
+    if (!SaveStateFile(path, gs)) return false;
+    GameState* check = new GameState();
+    auto t1 = std::chrono::steady_clock::now();
+    bool loaded = LoadStateFile(path, *check);
+    auto t2 = std::chrono::steady_clock::now();
+    delete check;
+    std::cout << "state snapshot: wave " << gs.currentWave << ", tick " << gs.tick << ", " << StateSnapshotSize(gs) << " bytes -> " << path
+              << "  save " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms  load " << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+    return loaded;
+}
+
+int RunHeadless(int waves, uint64_t seed, const char* recordPath, const char* statePath, bool endless) {
+    GameState gs; ResetGame(gs, seed, endless);
+    InputLog log; log.Begin(seed, endless ? REPLAY_ENDLESS : 0);
+    auto t0 = std::chrono::steady_clock::now();
+
+    while (gs.currentWave < waves) {
+        AutoBuildPhase(gs, log);
+        log.Dispatch(gs, ACT_START_WAVE);
+        if (statePath && gs.currentWave == waves && !CaptureState(statePath, gs)) { std::cerr << "failed to write state snapshot " << statePath << "\n"; return 1; }
+        if (!PlayScriptedWave(gs, log)) break;
+    }
+
+    PrintRunSummary(gs, std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+    if (recordPath && !log.Save(recordPath, gs)) { std::cerr << "failed to write replay " << recordPath << "\n"; return 1; }
+    return 0;
+}
+
+// Usage: vector-defense --replay <file>. Exits non-zero if the run diverges from the recording.
+int RunReplay(const char* path) {
+    InputLog log; ReplayHeader header;
+    if (!log.Load(path, header)) { std::cerr << "not a replay file: " << path << "\n"; return 1; }
+    GameState gs;
+    auto t0 = std::chrono::steady_clock::now();
+    ReplayLog(gs, log, header.finalTick);
+    PrintRunSummary(gs, std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+
+    bool match = gs.tick == header.finalTick && gs.score == header.finalScore && gs.currentWave == header.finalWave && HashGameState(gs) == header.finalHash;
+    std::cout << "replay " << (match ? "MATCHES" : "DIVERGES FROM") << " recording (" << header.eventCount << " events, seed " << header.seed << ")\n";
+    return match ? 0 : 2;
+}
+
+// --- BALANCE HARNESS ---
+// Usage: vector-defense --balance [games] [waves] [strategy|all] [out.csv]
+// Plays `games` headless games per strategy, one game per job across the job system (each
+// game's own ticks then run inline), and reports the distribution of wave reached, score and
+// time to clear each wave. Every strategy plays the same seeds, so differences come from the
+// strategy or the build's constants, never the draw. Results don't depend on --threads.
+struct BalanceStrategy {
+    const char* name;
+    void (*build)(GameState&, InputLog&); // Shop and placement for one build phase, ending with the towers down
+};
+
+const BalanceStrategy BALANCE_STRATEGIES[] = {
+    { "ring", AutoBuildPhase }, // The --headless script
+    { "fire-first", [](GameState& gs, InputLog& log) {
+          while (GetFireCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_FIRE);
+          while (GetSlotCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_SLOT);
+          if (gs.currency >= 450 && gs.coreHealth < gs.maxCoreHealth) log.Dispatch(gs, ACT_BUY_REPAIR);
+          log.Dispatch(gs, ACT_CLOSE_ARMORY);
+          PlaceTowerRing(gs, log, 140.0f);
+      } },
+    { "pulse-heavy", [](GameState& gs, InputLog& log) {
+          while (gs.pulseWaveCharges < 4 && gs.currency >= 300) log.Dispatch(gs, ACT_BUY_PULSE);
+          while (GetSlotCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_SLOT);
+          while (GetFireCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_FIRE);
+          log.Dispatch(gs, ACT_CLOSE_ARMORY);
+          PlaceTowerRing(gs, log, 140.0f);
+      } },
+    { "wide-ring", [](GameState& gs, InputLog& log) {
+          while (GetSlotCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_SLOT);
+          while (GetFireCost(gs) <= gs.currency) log.Dispatch(gs, ACT_BUY_FIRE);
+          if (gs.currency >= 450 && gs.coreHealth < gs.maxCoreHealth) log.Dispatch(gs, ACT_BUY_REPAIR);
+          log.Dispatch(gs, ACT_CLOSE_ARMORY);
+          PlaceTowerRing(gs, log, 260.0f);
+      } },
+};
+
+struct BalanceGame {
+    uint64_t seed;
+    int wave, score;
+    bool survived;
+    uint32_t ticks;
+    std::vector<float> clearSeconds; // Sim seconds from each wave's start to its clear
+};
+
+void PlayBalanceGame(BalanceGame& game, const BalanceStrategy& strategy, int waves, bool endless) {
+    GameState* gs = new GameState(); ResetGame(*gs, game.seed, endless);
+    InputLog log; log.Begin(game.seed, endless ? REPLAY_ENDLESS : 0);
+    game.clearSeconds.reserve(waves);
+    bool alive = true;
+    while (alive && gs->currentWave < waves) {
+        strategy.build(*gs, log);
+        log.Dispatch(*gs, ACT_START_WAVE);
+        uint32_t start = gs->tick;
+        alive = PlayScriptedWave(*gs, log);
+        if (alive) game.clearSeconds.push_back((gs->tick - start) * SIM_DT);
+    }
+    game.wave = gs->currentWave; game.score = gs->score; game.survived = alive; game.ticks = gs->tick;
+    delete gs;
+}
+
+// Value at fraction `q` of an ascending-sorted list.
+template <typename T> T Percentile(const std::vector<T>& sorted, double q) { return sorted.empty() ? T() : sorted[(size_t)(q * (sorted.size() - 1))]; }
+
+int RunBalance(int games, int waves, const char* only, const char* csvPath, bool endless) {
+    std::vector<const BalanceStrategy*> strategies;
+    for (const BalanceStrategy& st : BALANCE_STRATEGIES) if (!only || std::string(only) == "all" || std::string(only) == st.name) strategies.push_back(&st);
+    if (strategies.empty()) {
+        std::cerr << "unknown strategy " << only << "; one of: all";
+        for (const BalanceStrategy& st : BALANCE_STRATEGIES) std::cerr << " " << st.name;
+        std::cerr << "\n"; return 1;
+    }
+
+    std::vector<BalanceGame> results(strategies.size() * games);
+    for (size_t i = 0; i < results.size(); i++) results[i].seed = 1 + i % games;
+    auto t0 = std::chrono::steady_clock::now();
+    jobs.ParallelFor((int)results.size(), 1, [&](int b, int e) { for (int i = b; i < e; i++) PlayBalanceGame(results[i], *strategies[i / games], waves, endless); });
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    std::cout << "balance: " << games << " games x " << strategies.size() << " strategies, up to wave " << waves << (endless ? " (endless)" : "") << ", " << jobs.ThreadCount() << " threads, "
+              << wall << "s (" << (wall > 0 ? results.size() / wall : 0.0) << " games/s)\n";
+    std::cout << "strategy       survived   wave p10  p50  p90   mean    score p10      p50      p90\n";
+    int deepest = 0;
+    for (size_t s = 0; s < strategies.size(); s++) {
+        std::vector<int> wave, score; int survived = 0; double waveSum = 0;
+        for (int g = 0; g < games; g++) {
+            const BalanceGame& r = results[s * games + g];
+            wave.push_back(r.wave); score.push_back(r.score); survived += r.survived; waveSum += r.wave;
+            deepest = std::max(deepest, (int)r.clearSeconds.size());
+        }
+        std::sort(wave.begin(), wave.end()); std::sort(score.begin(), score.end());
+        std::cout << TextFormat("%-14s %8.1f%% %9d %4d %4d %6.2f %12d %8d %8d", strategies[s]->name, 100.0 * survived / games,
+                                Percentile(wave, 0.1), Percentile(wave, 0.5), Percentile(wave, 0.9), waveSum / games, Percentile(score, 0.1), Percentile(score, 0.5), Percentile(score, 0.9)) << "\n";
+    }
+
+    // Time to clear, per wave: median seconds over the games that cleared it, and how many did.
+    std::cout << "\nseconds to clear (median, games cleared)\nwave";
+    for (const BalanceStrategy* st : strategies) std::cout << TextFormat(" %18s", st->name);
+    std::cout << "\n";
+    for (int w = 0; w < deepest; w++) {
+        std::cout << TextFormat("%4d", w + 1);
+        for (size_t s = 0; s < strategies.size(); s++) {
+            std::vector<float> clear;
+            for (int g = 0; g < games; g++) { const BalanceGame& r = results[s * games + g]; if ((int)r.clearSeconds.size() > w) clear.push_back(r.clearSeconds[w]); }
+            std::sort(clear.begin(), clear.end());
+            std::cout << (clear.empty() ? TextFormat(" %18s", "-") : TextFormat(" %10.1fs %6d", Percentile(clear, 0.5), (int)clear.size()));
+        }
+        std::cout << "\n";
+    }
+
+    if (csvPath) {
+        std::ofstream csv(csvPath);
+        csv << "strategy,seed,wave,survived,score,ticks,clear_seconds\n";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BalanceGame& r = results[i];
+            csv << strategies[i / games]->name << "," << r.seed << "," << r.wave << "," << (r.survived ? 1 : 0) << "," << r.score << "," << r.ticks << ",";
+            for (size_t w = 0; w < r.clearSeconds.size(); w++) csv << (w ? ";" : "") << r.clearSeconds[w];
+            csv << "\n";
+        }
+        if (!csv.flush()) { std::cerr << "failed to write " << csvPath << "\n"; return 1; }
+        std::cout << "\nper-game results written to " << csvPath << "\n";
+    }
+    return 0;
+}
+
+// --- STEERING MICRO-BENCHMARK ---
+// Usage: vector-defense --bench-steer [enemies] [iterations]
+// Times SteerEnemies against the old atan2/cos/sin loop on the same random swarm.
+int RunSteeringBenchmark(int count, int iterations) {
+    SetRandomSeed(1);
+    EnemyStore base;
+    Vector2 core = { (float)SCREEN_WIDTH / 2, (float)SCREEN_HEIGHT / 2 };
+    for (int i = 0; i < count; i++) {
+        float angle = (float)GetRandomValue(0, 3600) * 0.1f * DEG2RAD, r = (float)GetRandomValue(60, 850);
+        base.Add({ { core.x + cosf(angle) * r, core.y + sinf(angle) * r }, (float)GetRandomValue(100, 180), 3, 3.6f, 3.6f, true, 22.0f, GetRandomValue(0, 3) == 0 ? 1.5f : 0.0f });
+    }
+
+    auto timeIt = [&](auto&& step, EnemyStore& store) {
+        store = base;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; it++) step(store);
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / ((double)iterations * count);
+    };
+    EnemyStore legacy, kernel;
+    double legacyNs = timeIt([&](EnemyStore& e) { SteerEnemiesLegacy(e, core, SIM_DT); }, legacy);
+    double kernelNs = timeIt([&](EnemyStore& e) { SteerEnemies(e, core, SIM_DT, 1.0f); }, kernel);
+
+    float maxError = 0.0f;
+    for (int i = 0; i < count; i++) maxError = std::max(maxError, GetDistance(legacy.Position(i), kernel.Position(i)));
+#if defined(VD_SIMD_AVX)
+    const char* path = "AVX";
+#elif defined(VD_SIMD_SSE2)
+    const char* path = "SSE2";
+#elif defined(VD_SIMD_NEON)
+    const char* path = "NEON";
+#else
+    const char* path = "scalar";
+#endif
+    std::cout << "enemies: " << count << "  iterations: " << iterations << "  kernel path: " << path << "\n"
+              << "legacy atan2/cos/sin: " << legacyNs << " ns/enemy\n"
+              << "SteerEnemies:         " << kernelNs << " ns/enemy  (" << (kernelNs > 0 ? legacyNs / kernelNs : 0.0) << "x)\n"
+              << "max position drift vs legacy: " << maxError << " px\n";
+    return 0;
+}
+
+// --- STRESS BENCHMARK ---
+// Canned worst-case scenarios run through the real StepSimulation and, with --render, the
+// real world/bloom draw path. Usage: vector-defense --bench [seconds per scenario] [--render]
+struct BenchScenario {
+    const char* name;
+    void (*setup)(GameState&);
+    void (*sustain)(GameState&); // Called before every tick to hold the load at its target level
+};
+
+void BenchPlaceTowers(GameState& gs, int count, bool tesla) {
+    gs.towers.Clear(); gs.maxTowers = count;
+    for (int i = 0; i < count; i++) {
+        float angle = (360.0f / count) * i * DEG2RAD;
+        gs.towers.Add(tesla ? TWR_TESLA : (TowerType)(i % 3), { gs.corePos.x + cosf(angle) * 160.0f, gs.corePos.y + sinf(angle) * 160.0f });
+    }
+}
+
+void BenchFillEnemies(GameState& gs, int target) { while (gs.enemies.Size() < target) gs.enemies.Add(MakeWaveEnemy(gs)); }
+
+void BenchCommonSetup(GameState& gs) {
+    ResetGame(gs, 1234);
+    gs.coreHealth = gs.maxCoreHealth = 1 << 30; // The core never falls, so every scenario runs its full duration
+    gs.cryoUnlocked = gs.teslaUnlocked = true;
+}
+
+// --bench --from: a state captured by --headless or the autosave, reloaded whenever its wave
+// ends or the core falls, so the scenario keeps replaying that stretch of a real game.
+GameState* gBenchCapture = nullptr;
+
+const BenchScenario BENCH_CAPTURED = { "captured state",
+    [](GameState& gs) { gs = *gBenchCapture; },
+    [](GameState& gs) { if (!gs.waveActive || gs.coreHealth <= 0) gs = *gBenchCapture; } };
+
+const BenchScenario BENCH_SCENARIOS[] = {
+    { "wave 50 + boss",
+      [](GameState& gs) { BenchCommonSetup(gs); BenchPlaceTowers(gs, 12, false); gs.towerFireRate = 0.2f; gs.currentWave = 50; },
+      [](GameState& gs) {
+          // The whole wave stays on screen instead of trickling in, with the boss always present.
+          if (gs.towers.Empty()) BenchPlaceTowers(gs, 12, false);
+          gs.waveActive = true; gs.enemiesToSpawn = 0; gs.bossInQueue = false;
+          bool bossAlive = false;
+          for (int i = 0; i < gs.enemies.Size(); i++) bossAlive |= gs.enemies.sides[i] == 24;
+          if (!bossAlive) gs.enemies.Add(MakeBoss(gs));
+          BenchFillEnemies(gs, 7 + gs.currentWave * 5 + 1);
+      } },
+    { "5000 enemies, 7 tesla",
+      [](GameState& gs) { BenchCommonSetup(gs); BenchPlaceTowers(gs, 7, true); gs.currentWave = 20; },
+      [](GameState& gs) { BenchFillEnemies(gs, 5000); } },
+    { "pulse spam, max particles",
+      [](GameState& gs) { BenchCommonSetup(gs); BenchPlaceTowers(gs, 8, false); gs.currentWave = 20; gs.waveActive = true; },
+      [](GameState& gs) {
+          BenchFillEnemies(gs, 1500);
+          if (gs.tick % 30 == 0) { gs.pulseWaveCharges = 1; TriggerPulse(gs); }
+          while (gs.particles.Size() < MAX_PARTICLES - 64) SpawnParticleBurst(gs.particles, gs.fxRng, { gs.corePos.x + (float)gs.fxRng.Range(-600, 600), gs.corePos.y + (float)gs.fxRng.Range(-340, 340) }, V_GOLD, 64, 3.0f);
+      } },
+    { "endless 100k horde",
+      [](GameState& gs) { BenchCommonSetup(gs); BenchPlaceTowers(gs, 16, false); gs.endless = true; gs.currentWave = 40; gs.waveActive = true; SpawnHorde(gs, 100000, 40000.0f); },
+      [](GameState& gs) {
+          if (gs.towers.Empty()) BenchPlaceTowers(gs, 16, false);
+          gs.waveActive = true;
+          if (gs.swarm.Empty()) SpawnHorde(gs, 100000, 40000.0f);
+      } },
+    { "overdrive, 0.05s fire rate",
+      [](GameState& gs) { BenchCommonSetup(gs); BenchPlaceTowers(gs, 16, false); gs.towerFireRate = 0.05f; gs.currentWave = 30; },
+      [](GameState& gs) { gs.overdriveTimer = 7.0f; BenchFillEnemies(gs, 2000); } },
+};
+
+struct BenchResult { double mean, p50, p99, max, simMean, allocsPerFrame; int frames; };
+
+BenchResult Summarize(std::vector<double>& frameMs, double simTotal, uint64_t allocs) {
+    BenchResult r = {}; r.frames = (int)frameMs.size();
+    if (frameMs.empty()) return r;
+    double total = 0; for (double v : frameMs) total += v;
+    std::sort(frameMs.begin(), frameMs.end());
+    r.mean = total / r.frames; r.simMean = simTotal / r.frames; r.allocsPerFrame = (double)allocs / r.frames;
+    r.p50 = frameMs[(size_t)(0.50 * (r.frames - 1))]; r.p99 = frameMs[(size_t)(0.99 * (r.frames - 1))]; r.max = frameMs.back();
+    return r;
+}
+
+int RunStressBenchmark(double seconds, bool render) {
+    BloomPipeline bloom; RenderTexture2D target = {}; PolyBatch* polys = nullptr; StaticLayer* staticLayer = nullptr;
+    if (render) {
+        SetTraceLogLevel(LOG_WARNING);
+        InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Vector Defense - Benchmark");
+        bloom.Load(); target = LoadRenderTexture(SCREEN_WIDTH, SCREEN_HEIGHT); polys = new PolyBatch(); staticLayer = new StaticLayer();
+    }
+
+    std::cout << "stress benchmark: " << seconds << "s per scenario, rendering " << (render ? "on" : "off") << "\n";
+    std::cout << "scenario                       frames   mean ms    p50 ms    p99 ms    max ms    sim ms  allocs/frame\n";
+    GameState* gs = new GameState();
+    std::vector<double> frameMs; frameMs.reserve(1 << 20);
+    std::vector<BenchScenario> scenarios(std::begin(BENCH_SCENARIOS), std::end(BENCH_SCENARIOS));
+    if (gBenchCapture) scenarios.push_back(BENCH_CAPTURED);
+    for (const BenchScenario& sc : scenarios) {
+        sc.setup(*gs);
+        frameMs.clear();
+        double simTotal = 0; uint64_t allocs = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < seconds && !(render && WindowShouldClose())) {
+            auto f0 = std::chrono::steady_clock::now();
+            uint64_t a0 = gAllocationCount.load(std::memory_order_relaxed);
+            sc.sustain(*gs);
+            StepSimulation(*gs, SIM_DT);
+            gs->sfxBlip = gs->sfxBoom = gs->sfxShoot = 0;
+            auto f1 = std::chrono::steady_clock::now();
+            if (render) {
+                staticLayer->Update(*gs, true, true);
+                BeginTextureMode(target);
+                    staticLayer->Draw();
+                    DrawWorld(*gs, *polys, CameraView(Camera2D{ { 0, 0 }, { 0, 0 }, 0.0f, 1.0f }, 0.0f), QUALITY_TIERS[QUALITY_FULL], 1.0f);
+                    polys->Flush();
+                EndTextureMode();
+                BeginDrawing();
+                    ClearBackground(V_BLACK);
+                    bloom.Apply(target, { 0, 0, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT });
+                    DrawText(sc.name, 20, 20, 20, V_WHITE);
+                EndDrawing();
+            }
+            auto f2 = std::chrono::steady_clock::now();
+            allocs += gAllocationCount.load(std::memory_order_relaxed) - a0;
+            simTotal += std::chrono::duration<double, std::milli>(f1 - f0).count();
+            frameMs.push_back(std::chrono::duration<double, std::milli>(f2 - f0).count());
+        }
+        BenchResult r = Summarize(frameMs, simTotal, allocs);
+        std::cout << TextFormat("%-28s %8d %9.3f %9.3f %9.3f %9.3f %9.3f %13.2f", sc.name, r.frames, r.mean, r.p50, r.p99, r.max, r.simMean, r.allocsPerFrame) << "\n";
+    }
+    delete gs;
+
+    if (render) { staticLayer->Unload(); delete staticLayer; delete polys; bloom.Unload(); UnloadRenderTexture(target); CloseWindow(); }
+    return 0;
+}
+
+// --- MAIN APPLICATION ---
+// Finds `name` anywhere on the command line and removes it, with its value, from argv.
+// `values` is TAKE_NONE (every copy of the flag is removed), TAKE_ONE (the first copy with a
+// value is taken; the flag is ignored without one) or TAKE_OPTIONAL (the next argument is
+// taken unless it is another flag); `*value` is the taken value or null.
+enum TakeValues { TAKE_NONE, TAKE_ONE, TAKE_OPTIONAL };
+bool TakeFlag(int& argc, char** argv, const char* name, TakeValues values = TAKE_NONE, const char** value = nullptr) {
+    bool found = false;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], name) != 0) continue;
+        bool hasNext = a + 1 < argc && (values == TAKE_ONE || (values == TAKE_OPTIONAL && argv[a + 1][0] != '-'));
+        if (values == TAKE_ONE && !hasNext) return false;
+        int n = hasNext ? 2 : 1;
+        if (value) *value = hasNext ? argv[a + 1] : nullptr;
+        for (int b = a; b + n <= argc; b++) argv[b] = argv[b + n];
+        argc -= n; found = true;
+        if (values != TAKE_NONE) break;
+        a--; // Recheck the argument that moved into this slot
+    }
+    return found;
+}
+
+int main(int argc, char** argv) {
+    const char* value = nullptr;
+    // --threads N (anywhere on the command line) sizes the job system; 1 runs everything inline.
+    int threadCount = (int)std::min(8u, std::max(1u, std::thread::hardware_concurrency()));
+    if (TakeFlag(argc, argv, "--threads", TAKE_ONE, &value)) threadCount = std::max(1, std::atoi(value));
+    jobs.Start(threadCount - 1);
+    // --alloc-assert aborts on the first steady-state gameplay frame that allocates; build with
+    // -DVD_ALLOC_TRACKING to get the per-stage breakdown with it.
+    // --frame-budget MS sets the quality governor's target (and the frame cap), e.g. 6.9 for 144 Hz.
+    QualityGovernor governor;
+    if (TakeFlag(argc, argv, "--frame-budget", TAKE_ONE, &value)) governor.budgetMs = std::max(1.0f, (float)std::atof(value));
+    // --render-scale S starts the world at S times the window's native resolution (0.5 to 2).
+    RenderScaler display;
+    if (TakeFlag(argc, argv, "--render-scale", TAKE_ONE, &value)) display.manual = std::clamp((float)std::atof(value), RenderScaler::STEPS[0], RenderScaler::STEPS[RenderScaler::STEP_COUNT - 1]);
+    // --vsync paces frames to the display and --uncapped renders as fast as possible; either
+    // way the simulation keeps its fixed tick and rendering interpolates between ticks.
+    bool vsync = TakeFlag(argc, argv, "--vsync"), uncapped = TakeFlag(argc, argv, "--uncapped");
+    // --frame-delay [MS|auto] waits at the start of each frame and samples input after the
+    // wait (see FramePacer); `auto`, the default, fits the wait to recent frame times.
+    FramePacer pacer;
+    if (TakeFlag(argc, argv, "--frame-delay", TAKE_OPTIONAL, &value)) {
+        pacer.enabled = true;
+        pacer.autoDelay = !value || std::string(value) == "auto";
+        if (!pacer.autoDelay) pacer.delay = std::max(0.0, std::atof(value) * 1e-3);
+    }
+    pacer.capped = !vsync && !uncapped;
+    pacer.period = uncapped ? 0.0 : governor.budgetMs * 1e-3;
+    // --endless sends every wave as a far-field horde (windowed, --headless and --balance).
+    bool endless = TakeFlag(argc, argv, "--endless");
+    bool allocAssert = TakeFlag(argc, argv, "--alloc-assert");
+
+    // --resume [file] continues the windowed game from a state snapshot (default: the autosave).
+    const char* resumePath = nullptr;
+    if (TakeFlag(argc, argv, "--resume", TAKE_OPTIONAL, &value)) resumePath = value ? value : AUTOSAVE_FILE;
+
+    // --telemetry [file] logs per-wave gameplay and frame-time records (default: telemetry.vdt).
+    const char* telemetryPath = nullptr;
+    if (TakeFlag(argc, argv, "--telemetry", TAKE_OPTIONAL, &value)) telemetryPath = value ? value : TELEMETRY_FILE;
+
+    if (argc > 1 && std::string(argv[1]) == "--headless") {
+        int waves = (argc > 2) ? std::atoi(argv[2]) : 50;
+        uint64_t seed = (argc > 3) ? std::strtoull(argv[3], nullptr, 10) : 1;
+        const char* recordPath = (argc > 4 && std::string(argv[4]) != "-") ? argv[4] : nullptr;
+        return RunHeadless(waves, seed, recordPath, (argc > 5) ? argv[5] : nullptr, endless);
+    }
+    if (argc > 2 && std::string(argv[1]) == "--replay") return RunReplay(argv[2]);
+    if (argc > 2 && std::string(argv[1]) == "--telemetry-dump") return RunTelemetryDump(argv[2]);
+    if (argc > 1 && std::string(argv[1]) == "--balance") {
+        int games = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 1000;
+        int waves = (argc > 3) ? std::max(1, std::atoi(argv[3])) : 50;
+        return RunBalance(games, waves, (argc > 4) ? argv[4] : nullptr, (argc > 5) ? argv[5] : nullptr, endless);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        double seconds = (argc > 2) ? std::atof(argv[2]) : 5.0;
+        bool render = false;
+        for (int a = 2; a < argc; a++) {
+            std::string arg = argv[a];
+            if (arg == "--render") render = true;
+            else if (arg == "--from" && a + 1 < argc) {
+                gBenchCapture = new GameState();
+                if (!LoadStateFile(argv[++a], *gBenchCapture)) { std::cerr << "not a state snapshot: " << argv[a] << "\n"; return 1; }
+            }
+        }
+        int result = RunStressBenchmark(seconds > 0 ? seconds : 5.0, render);
+        delete gBenchCapture;
+        return result;
+    }
+    if (argc > 1 && std::string(argv[1]) == "--bench-steer") {
+        return RunSteeringBenchmark((argc > 2) ? std::atoi(argv[2]) : 4096, (argc > 3) ? std::atoi(argv[3]) : 2000);
+    }
+
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_WINDOW_HIGHDPI | (vsync ? FLAG_VSYNC_HINT : 0));
+    InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Vector-Defense | Prime Edition");
+    SetWindowMinSize(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
+    SetTargetFPS((vsync || uncapped || pacer.enabled) ? 0 : (int)roundf(1000.0f / governor.budgetMs));
+
+    // --- ASSET LOADING ---
+    // The leaderboard loads on a worker while the first frame shows a splash. The audio
+    // device, sounds and bloom shaders have to be created on this thread, so they come up
+    // right after the splash is presented. Only the leaderboard screen and saving a score
+    // wait for the worker.
+    std::thread scoreLoader(LoadHighScores);
+    auto awaitScores = [&] { if (scoreLoader.joinable()) scoreLoader.join(); };
+    display.Update(INFINITY);
+    BeginDrawing();
+        ClearBackground(V_BLACK);
+        BeginMode2D(display.HudCamera());
+            DrawText("VECTOR DEFENSE", SCREEN_WIDTH/2 - MeasureText("VECTOR DEFENSE", 60)/2, 220, 60, V_CYAN);
+            DrawText("BOOTING...", SCREEN_WIDTH/2 - MeasureText("BOOTING...", 20)/2, 320, 20, V_DARKGRAY);
+        EndMode2D();
+    EndDrawing();
+
+    InitAudioDevice();
+    AudioVoices* audio = new AudioVoices();
+    audio->Load();
+
+    BloomPipeline bloom; bloom.Load();
+    BloomQuality bloomChoice = bloom.quality; // [F2]; the governor may cap it lower
+
+    GameScreen currentScreen = START_MENU;
+    // Every session is recorded; the seed plus the action log is written out at game over
+    // (and on quit) so a run can be re-simulated with --replay.
+    SimThread* sim = new SimThread();
+    GameState* resumed = nullptr;
+    if (resumePath) {
+        resumed = new GameState();
+        if (LoadStateFile(resumePath, *resumed)) TraceLog(LOG_INFO, "RESUME: wave %d, tick %u from %s", resumed->currentWave, resumed->tick, resumePath);
+        else { TraceLog(LOG_WARNING, "RESUME: %s is not a valid state snapshot, starting a new game", resumePath); delete resumed; resumed = nullptr; }
+    }
+    TelemetryWriter* telemetry = nullptr;
+    FrameTelemetry frameTelemetry;
+    if (telemetryPath) {
+        telemetry = new TelemetryWriter();
+        if (telemetry->Start(telemetryPath)) { sim->telemetry = telemetry; TraceLog(LOG_INFO, "TELEMETRY: logging to %s", telemetryPath); }
+        else { TraceLog(LOG_WARNING, "TELEMETRY: cannot open %s", telemetryPath); delete telemetry; telemetry = nullptr; }
+    }
+    sim->endless = endless;
+    sim->Start((uint64_t)time(nullptr), resumed);
+    delete resumed;
+    uint32_t simGeneration = 0;
+    const Vector2 corePos = sim->gs.corePos;
+
+    char playerName[13] = "\0";
+    int letterCount = 0;
+    bool scoreSaved = false;
+
+    Camera2D camera = { 0 }; camera.zoom = 1.0f;
+    CachedPanel guidePanel, leaderboardPanel, armoryPanel;
+    StaticLayer staticLayer;
+    PolyBatch polys;
+    std::vector<MenuShape> menuShapes;
+
+    for (int i = 0; i < 20; i++) {
+        menuShapes.push_back({{(float)GetRandomValue(0, SCREEN_WIDTH), (float)GetRandomValue(0, SCREEN_HEIGHT)}, (float)GetRandomValue(40, 100)/100.0f, (float)GetRandomValue(0, 360), (float)GetRandomValue(-20, 20)/10.0f, GetRandomValue(3, 8), (float)GetRandomValue(30, 120)});
+    }
+
+    profiler.enabled = true;
+    int gameplayFrames = 0;
+    FrameInput input;
+    InputLatency latency;
+    double pollTime = SimClock(); // When EndDrawing() last polled input
+
+    // --- GAME LOOP ---
+    while (!WindowShouldClose()) {
+        profiler.BeginFrame(); frameArena.Reset();
+        input = {}; input.Latch(pollTime);
+        if (pacer.enabled) {
+            ProfileScope scope(PROF_PRESENT); // The wait stands in for the raylib frame cap
+            pacer.Adapt(profiler); pacer.Wait();
+            PollInputEvents(); pollTime = SimClock(); input.Latch(pollTime);
+        }
+        // The update reads this snapshot; rendering latches a newer one, after which it is gone.
+        const SimSnapshot& inputSnapshot = sim->snapshots.Front();
+        const GameState& inputState = inputSnapshot.state;
+        const float frameScale = std::min(GetFrameTime(), 0.1f) * 60.0f; // Frontend-only motion is tuned per 60 Hz frame
+        bool uiBlip = false;
+        Vector2 mousePos = input.mouse;
+
+        if (input.Pressed(KEY_F2)) bloomChoice = (BloomQuality)((bloomChoice + 1) % 3);
+        if (input.Pressed(KEY_F5)) { governor.enabled = !governor.enabled; governor.tier = QUALITY_FULL; }
+        if (input.Pressed(KEY_F3)) profiler.overlayVisible = !profiler.overlayVisible;
+        if (input.Pressed(KEY_F4)) { if (profiler.DumpCSV("profile.csv")) TraceLog(LOG_INFO, "PROFILER: %d frames written to profile.csv", profiler.filled); }
+        if (input.Pressed(KEY_F6)) display.Step(-1);
+        if (input.Pressed(KEY_F7)) display.Step(+1);
+        if (input.Pressed(KEY_ESCAPE) || input.Pressed(KEY_P)) {
+            if (currentScreen == GAMEPLAY) currentScreen = PAUSED;
+            else if (currentScreen == PAUSED) currentScreen = GAMEPLAY;
+        }
+
+        auto onUi = [&](Vector2 p) {
+            bool overPulse = inputState.waveActive && inputState.pulseWaveCharges > 0 && CheckCollisionPointRec(p, BTN_PULSE);
+            return p.y < UI_HEADER_HEIGHT || (CanBuild(inputState) && p.y > SCREEN_HEIGHT - UI_FOOTER_HEIGHT) || overPulse || (currentScreen == UPGRADE_MENU) || (currentScreen == GAME_OVER) || (currentScreen == PAUSED);
+        };
+
+        // --- SYSTEM UPDATE ---
+        // All hit-testing happens here against the BTN_ rectangles, so a click acts on the
+        // frame that sampled it and the HUD pass only draws.
+        switch (currentScreen) {
+            case START_MENU: {
+                for (auto &ms : menuShapes) {
+                    ms.pos.y -= ms.speed * frameScale; ms.rotation += ms.rotSpeed * frameScale;
+                    if (ms.pos.y < -ms.size) { ms.pos.y = SCREEN_HEIGHT + ms.size; ms.pos.x = (float)GetRandomValue(0, SCREEN_WIDTH); }
+                }
+                if (input.Pressed(KEY_ENTER)) { uiBlip = true; currentScreen = GAMEPLAY; }
+                else if (input.Clicked(BTN_BOOT)) currentScreen = GAMEPLAY;
+                else if (input.Clicked(BTN_LEADERBOARD)) { awaitScores(); currentScreen = LEADERBOARD; }
+                else if (input.Clicked(BTN_GUIDE)) currentScreen = GUIDE;
+            } break;
+
+            case GUIDE: case LEADERBOARD: { if (input.Pressed(KEY_ESCAPE) || input.Pressed(KEY_BACKSPACE) || input.Clicked(BTN_RETURN)) currentScreen = START_MENU; } break;
+
+            case PAUSED: {
+                if (input.Clicked(BTN_RESUME)) currentScreen = GAMEPLAY;
+                else if (input.Clicked(BTN_QUIT)) currentScreen = START_MENU;
+            } break;
+
+            case UPGRADE_MENU: {
+                if (input.Clicked(BTN_BUY_SLOT)) sim->Send(ACT_BUY_SLOT);
+                if (input.Clicked(BTN_BUY_PULSE)) sim->Send(ACT_BUY_PULSE);
+                if (input.Clicked(BTN_BUY_FIRE)) sim->Send(ACT_BUY_FIRE);
+                if (input.Clicked(BTN_BUY_REPAIR)) sim->Send(ACT_BUY_REPAIR);
+
+                if (input.Pressed(KEY_U) || input.Pressed(KEY_ENTER)) { currentScreen = GAMEPLAY; sim->Send(ACT_CLOSE_ARMORY); }
+            } break;
+
+            case GAMEPLAY: {
+                if (input.Pressed(KEY_ONE)) sim->Send(ACT_SELECT, TWR_STANDARD);
+                if (input.Pressed(KEY_TWO)) sim->Send(ACT_SELECT, TWR_CRYO);
+                if (input.Pressed(KEY_THREE)) sim->Send(ACT_SELECT, TWR_TESLA);
+                bool pulseShown = inputState.waveActive && inputState.pulseWaveCharges > 0;
+                if (input.Pressed(KEY_SPACE) || (pulseShown && input.Clicked(BTN_PULSE))) sim->Send(ACT_PULSE);
+                if (input.click && !onUi(input.clickPos)) sim->Send(ACT_CLICK, 0, input.clickPos);
+                if (CanBuild(inputState) && input.Clicked(BTN_ARMORY)) currentScreen = UPGRADE_MENU;
+                if (CanBuild(inputState) && input.Clicked(BTN_START_WAVE)) sim->Send(ACT_START_WAVE);
+
+                if (inputSnapshot.generation == simGeneration && inputState.coreHealth <= 0) { currentScreen = GAME_OVER; scoreSaved = false; playerName[0] = '\0'; letterCount = 0; }
+                if (input.Pressed(KEY_U) && !inputState.waveActive) { currentScreen = UPGRADE_MENU; }
+            } break;
+
+            case GAME_OVER: {
+                for (int i = 0; i < input.charCount; i++) { int key = input.chars[i]; if ((key >= 32) && (key <= 125) && (letterCount < 12)) { playerName[letterCount] = (char)key; playerName[letterCount+1] = '\0'; letterCount++; } }
+                if (input.Pressed(KEY_BACKSPACE)) { letterCount--; if (letterCount < 0) { letterCount = 0; } playerName[letterCount] = '\0'; }
+                if (!scoreSaved && input.Clicked(BTN_SAVE_SCORE)) { awaitScores(); SaveScore(playerName, inputState.score); scoreSaved = true; }
+                if (input.Clicked(BTN_REBOOT)) { sim->Reset((uint64_t)time(nullptr)); simGeneration++; currentScreen = GAMEPLAY; }
+            } break;
+        }
+        latency.Begin(input.sampleTime, sim->commandsSent);
+        bool mouseOnUi = onUi(mousePos);
+
+        // Latched after the update so the commands it just sent can show in this frame.
+        const SimSnapshot& snapshot = sim->LatchSnapshot();
+        const GameState& gs = snapshot.state; // Read-only view; all changes go through sim->Send()
+        const float alpha = InterpolationAlpha(snapshot);
+
+        // Shake and flash decay with the simulation, so they only show while it is running.
+        const QualitySettings& quality = governor.Settings();
+        sim->qualityTier.store(governor.enabled ? governor.tier : QUALITY_FULL, std::memory_order_relaxed);
+        bloom.SetQuality(std::min(bloomChoice, quality.bloom));
+        display.Update(quality.renderScale);
+        camera.zoom = display.WorldZoom(); // The world camera draws canvas units into target pixels
+        float shake = std::min(gs.shakeIntensity, quality.shakeCap);
+        if (currentScreen == GAMEPLAY && shake > 0) {
+            camera.offset.x = GetRandomValue(-shake, shake) * camera.zoom;
+            camera.offset.y = GetRandomValue(-shake, shake) * camera.zoom;
+        } else { camera.offset = {0,0}; }
+
+        // --- AUDIO ---
+        sim->running = (currentScreen == GAMEPLAY);
+        audio->Play(SND_BLIP, sim->sfxBlip.exchange(0) + (uiBlip ? 1 : 0));
+        audio->Play(SND_BOOM, sim->sfxBoom.exchange(0));
+        audio->Play(SND_SHOOT, sim->sfxShoot.exchange(0));
+
+        // --- RENDERING PIPELINE ---
+        ProfileScope worldScope(PROF_WORLD_DRAW);
+        bool showWorld = currentScreen != GUIDE && currentScreen != LEADERBOARD;
+        staticLayer.Update(gs, showWorld && currentScreen != START_MENU, showWorld, camera.zoom);
+        BeginTextureMode(display.target);
+            ClearBackground(V_BLACK); // Shake can push the layer's overscan off-screen
+            BeginMode2D(camera);
+                staticLayer.Draw();
+
+                if (currentScreen == START_MENU) {
+                    for (const auto& ms : menuShapes) polys.Add(ms.pos, ms.sides, ms.size, ms.rotation, 1.5f, BLANK, ColorAlpha(V_DARKGRAY, 0.4f));
+                    polys.Flush();
+                    DrawTextCached("VECTOR DEFENSE", SCREEN_WIDTH/2 - MeasureTextCached("VECTOR DEFENSE", 60)/2, 220, 60, V_CYAN);
+                }
+                if (showWorld) {
+                    DrawWorld(gs, polys, CameraView(camera, shake, (float)display.target.texture.width, (float)display.target.texture.height), quality, alpha);
+                    if (currentScreen == GAMEPLAY && !mouseOnUi && gs.towers.Size() < gs.maxTowers) {
+                        bool valid = GetDistance(mousePos, corePos) > EXCLUSION_RADIUS;
+                        DrawCircleLines((int)mousePos.x, (int)mousePos.y, gs.towerRange, ColorAlpha(valid ? V_WHITE : V_RED, 0.3f));
+                        TowerSet::Dispatch(gs.currentSelection, [&](auto policy) { polys.AddHealthBody(mousePos, decltype(policy)::SIDES, 18, 1.0f, ColorAlpha(valid ? decltype(policy)::Body() : V_RED, 0.5f)); });
+                    }
+                    polys.Flush();
+                }
+            EndMode2D();
+        EndTextureMode();
+        worldScope.Stop();
+
+        BeginDrawing();
+            ClearBackground(V_BLACK);
+            BeginMode2D(display.HudCamera()); // Everything below is in canvas units at native resolution
+            { ProfileScope scope(PROF_BLOOM); bloom.Apply(display.target, { 0, 0, (float)SCREEN_WIDTH, (float)SCREEN_HEIGHT }); }
+            ProfileScope hudScope(PROF_HUD);
+
+            if (currentScreen == GAMEPLAY && gs.damageFlashTimer > 0) DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_RED, gs.damageFlashTimer * 1.5f));
+
+            if (currentScreen == START_MENU) {
+                DrawCustomButton(BTN_BOOT, "BOOT SEQUENCE", V_LIME, mousePos);
+                DrawCustomButton(BTN_LEADERBOARD, "LEADERBOARD", V_GOLD, mousePos);
+                DrawCustomButton(BTN_GUIDE, "SYSTEM GUIDE", V_WHITE, mousePos);
+            }
+            else if (currentScreen == PAUSED) {
+                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_BLACK, 0.6f));
+                DrawTextCached("SYSTEM PAUSED", SCREEN_WIDTH/2 - MeasureTextCached("SYSTEM PAUSED", 40)/2, 280, 40, V_CYAN);
+                DrawCustomButton(BTN_RESUME, "RESUME", V_LIME, mousePos);
+                DrawCustomButton(BTN_QUIT, "QUIT", V_RED, mousePos);
+            }
+            else if (currentScreen == GUIDE || currentScreen == LEADERBOARD) {
+                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_BLACK, 0.95f));
+                if (currentScreen == GUIDE) {
+                    guidePanel.Draw(0, [] {
+                        DrawTextCached("SYSTEM OPERATIONAL GUIDE", 60, 60, 35, V_SKYBLUE);
+                        int x1 = 70, x2 = 650, y = 140;
+                        DrawTextCached("THREAT LOG", x1, y, 22, V_RED); DrawTextCached("- Splitting: Complex shapes split into fragments.", x1, y+35, 18, V_WHITE); DrawTextCached("- BOSS LOG: Heavy Primes emerge every 10 waves.", x1, y+60, 18, V_GOLD);
+                        DrawTextCached("DEFENSE LOG", x1, y+130, 22, V_LIME); DrawTextCached("- [1] Standard: Green squares. Normal DPS.", x1, y+165, 18, V_WHITE); DrawTextCached("- [2] Cryo-Slow: Blue hexagons. Freezes threats.", x1, y+190, 18, V_WHITE); DrawTextCached("- [3] Tesla: Gold Octagon. Chain lightning.", x1, y+215, 18, V_WHITE);
+                        DrawTextCached("POWER-UPS", x2, y, 22, V_GOLD); DrawTextCached("- [EMP] Purple: Total movement lock-down.", x2, y+35, 18, V_PURPLE); DrawTextCached("- [OVERDRIVE] Gold: Maximum fire-rate sparks.", x2, y+60, 18, V_GOLD); DrawTextCached("- [NANOBOTS] Cyan: Core absorption repair.", x2, y+85, 18, V_SKYBLUE);
+                        DrawTextCached("SYSTEM CYCLE", x2, y+155, 22, V_CYAN); DrawTextCached("- [SPACE/Button]: Discharge Red Pulse charges.", x2, y+190, 18, V_WHITE); DrawTextCached("- Armory [U]: Upgrade slots and laser fire speed.", x2, y+215, 18, V_WHITE);
+                    }, display.NativeScale());
+                } else {
+                    leaderboardPanel.Draw(highScoresVersion, [] {
+                        DrawTextCached("SYSTEM HALL OF FAME", SCREEN_WIDTH/2 - MeasureTextCached("SYSTEM HALL OF FAME", 35)/2, 60, 35, V_GOLD);
+                        for(int i=0; i<std::min(10, (int)highScores.size()); i++) { DrawTextCached(TextFormat("%d. %s", i+1, highScores[i].name.c_str()), SCREEN_WIDTH/2 - 200, 140 + (i*40), 22, V_WHITE); DrawTextCached(TextFormat("%d", highScores[i].score), SCREEN_WIDTH/2 + 150, 140 + (i*40), 22, V_SKYBLUE); }
+                    }, display.NativeScale());
+                }
+                DrawCustomButton(BTN_RETURN, "< RETURN", V_WHITE, mousePos);
+            } else if (currentScreen == GAMEPLAY || currentScreen == UPGRADE_MENU) {
+                DrawRectangle(0, 0, SCREEN_WIDTH, UI_HEADER_HEIGHT, ColorAlpha(V_BLACK, 0.95f));
+                DrawTextCached(TextFormat("INTEGRITY: %d", gs.coreHealth), 25, 20, 22, gs.coreHealth < 5 ? V_RED : V_WHITE); DrawTextCached(TextFormat("FRAGMENTS: %d", gs.currency), 220, 20, 22, V_GOLD); DrawTextCached(TextFormat("NODES: %d/%d", gs.towers.Size(), gs.maxTowers), 420, 20, 22, V_LIME); DrawTextCached(TextFormat("WAVE: %d", gs.currentWave), 580, 20, 22, V_SKYBLUE); DrawTextCached(TextFormat("PULSE: %d", gs.pulseWaveCharges), 720, 20, 22, V_CYAN);
+                TowerSet::Dispatch(gs.currentSelection, [](auto policy) { DrawTextCached(TextFormat("ACTIVE: %s", decltype(policy)::NAME), SCREEN_WIDTH - 250, 20, 20, decltype(policy)::Body()); });
+
+                if (gs.waveIntroTimer > 0) {
+                    float alpha = (gs.waveIntroTimer > 1.0f) ? 1.0f : gs.waveIntroTimer;
+                    const char* waveText = frameArena.Format("WAVE %d", gs.currentWave);
+                    DrawTextCached(waveText, SCREEN_WIDTH/2 - MeasureTextCached(waveText, 80)/2, SCREEN_HEIGHT/2 - 40, 80, ColorAlpha(V_WHITE, alpha));
+                }
+
+                if (gs.waveActive) {
+                    if (gs.pulseWaveCharges > 0) {
+                        DrawRectangleRec(BTN_PULSE, CheckCollisionPointRec(mousePos, BTN_PULSE) ? ColorAlpha(V_SKYBLUE, 0.35f) : ColorAlpha(V_DARKGRAY, 0.6f));
+                        DrawRectangleLinesEx(BTN_PULSE, 2, CheckCollisionPointRec(mousePos, BTN_PULSE) ? V_SKYBLUE : ColorAlpha(V_WHITE, 0.2f));
+                        int tw = MeasureTextCached(TextFormat("ACTIVATE PULSE [%d]", gs.pulseWaveCharges), 18);
+                        DrawTextCached(TextFormat("ACTIVATE PULSE [%d]", gs.pulseWaveCharges), BTN_PULSE.x + (BTN_PULSE.width/2 - tw/2), BTN_PULSE.y + (BTN_PULSE.height/2 - 9), 18, V_WHITE);
+                    }
+                    DrawTextCached(TextFormat("THREATS: %d", gs.enemies.Size() + gs.swarm.count + gs.enemiesToSpawn + (gs.bossInQueue?1:0)), 25, SCREEN_HEIGHT - 35, 20, V_SKYBLUE);
+                    DrawSwarmMarkers(gs);
+                }
+                for (int i = 0; i < gs.notifications.Size(); i++) DrawTextCached(gs.notifications[i].text, SCREEN_WIDTH/2 - MeasureTextCached(gs.notifications[i].text, 30)/2, 110 + (i * 45), 30, ColorAlpha(gs.notifications[i].col, gs.notifications[i].timer/2.0f));
+
+                if (currentScreen == GAMEPLAY && CanBuild(gs)) {
+                    DrawRectangle(0, SCREEN_HEIGHT - UI_FOOTER_HEIGHT, SCREEN_WIDTH, UI_FOOTER_HEIGHT, ColorAlpha(V_BLACK, 0.85f));
+                    DrawTextCached("SYSTEM IDLE // BUILD PHASE", 40, SCREEN_HEIGHT - 55, 20, V_SKYBLUE);
+                    DrawTextCached(frameArena.Format("[1] STANDARD%s%s", gs.cryoUnlocked ? " | [2] CRYO" : "", gs.teslaUnlocked ? " | [3] TESLA" : ""), 40, SCREEN_HEIGHT - 75, 18, V_DARKGRAY);
+                    DrawCustomButton(BTN_ARMORY, "OPEN ARMORY [U]", V_GOLD, mousePos);
+                    DrawCustomButton(BTN_START_WAVE, "START WAVE", V_LIME, mousePos);
+                }
+                if (currentScreen == UPGRADE_MENU) {
+                    DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, ColorAlpha(V_BLACK, 0.9f));
+                    int currency = gs.currency;
+                    armoryPanel.Draw((uint64_t)(uint32_t)currency, [currency] {
+                        DrawTextCached("SYSTEM ARMORY", SCREEN_WIDTH/2 - 120, 60, 35, V_SKYBLUE); DrawTextCached(TextFormat("AVAILABLE DATA: %d", currency), SCREEN_WIDTH/2 - MeasureTextCached(TextFormat("AVAILABLE DATA: %d", currency), 24)/2, 120, 24, V_GOLD);
+                        DrawTextCached("PRESS [U] TO DISMISS", SCREEN_WIDTH/2 - 115, 540, 20, V_DARKGRAY);
+                    }, display.NativeScale());
+                    int sC = GetSlotCost(gs); int fC = GetFireCost(gs);
+
+                    DrawCustomButton(BTN_BUY_SLOT, TextFormat("BUY NODE SLOT (%d)", sC), V_LIME, mousePos);
+                    DrawCustomButton(BTN_BUY_PULSE, "PULSE CHARGE (300)", V_SKYBLUE, mousePos);
+                    DrawCustomButton(BTN_BUY_FIRE, TextFormat("OVERCLOCK FIRE (%d)", fC), V_GOLD, mousePos);
+                    DrawCustomButton(BTN_BUY_REPAIR, "CORE REPAIR (450)", V_CYAN, mousePos);
+
+                }
+            } else if (currentScreen == GAME_OVER) {
+                DrawRectangle(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, { 40, 10, 12, 255 });
+                DrawTextCached("SYSTEM FAILURE", SCREEN_WIDTH/2 - MeasureTextCached("SYSTEM FAILURE", 45)/2, 60, 45, V_RED);
+                int bW = 800, bH = 420, bX = SCREEN_WIDTH/2 - bW/2, bY = 140;
+                DrawRectangle(bX, bY, bW, bH, ColorAlpha(V_BLACK, 0.7f)); DrawRectangleLines(bX, bY, bW, bH, V_DARKGRAY);
+                DrawTextCached("MISSION PERFORMANCE LOG", bX + 40, bY + 30, 26, V_SKYBLUE);
+                DrawTextCached(TextFormat("TOTAL DATA: %d", gs.score), bX + 40, bY + 90, 20, V_WHITE);
+                DrawTextCached(TextFormat("WAVE DEPTH: %d", gs.currentWave), bX + 40, bY + 125, 20, V_WHITE);
+                DrawTextCached(TextFormat("REMAINING FRAGMENTS: %d", gs.currency), bX + 40, bY + 160, 20, V_GOLD);
+
+                DrawTextCached("FINAL CONFIG:", bX + 440, bY + 90, 20, V_LIME);
+                DrawTextCached(TextFormat("- NODES: %d", gs.maxTowers), bX + 440, bY + 125, 18, V_WHITE);
+                DrawTextCached(TextFormat("- RECHARGE: %.2fs", gs.towerFireRate), bX + 440, bY + 155, 18, V_WHITE);
+
+                if (!scoreSaved) {
+                    DrawTextCached("RECOVER SURVIVOR DATA?", bX + 40, bY + 230, 22, V_CYAN);
+                    DrawRectangle(bX + 40, bY + 270, 300, 50, ColorAlpha(V_DARKGRAY, 0.5f));
+                    DrawRectangleLines(bX + 40, bY + 270, 300, 50, V_CYAN);
+                    DrawTextCached(playerName, bX + 55, bY + 282, 24, V_WHITE);
+                    if ((GetTime() * 2) - (int)(GetTime() * 2) > 0.5) { DrawRectangle(bX + 55 + MeasureTextCached(playerName, 24), bY + 280, 15, 30, V_WHITE); }
+                    DrawCustomButton(BTN_SAVE_SCORE, "SAVE DATA", V_CYAN, mousePos, 20);
+                } else { DrawTextCached("DATA SYNCED TO HALL OF FAME", bX + 40, bY + 282, 22, V_LIME); }
+
+                DrawCustomButton(BTN_REBOOT, "REBOOT SYSTEM", V_GOLD, mousePos);
+            }
+            hudScope.Stop();
+            profiler.DrawOverlay(SCREEN_WIDTH - 340, UI_HEADER_HEIGHT + 10);
+            if (profiler.overlayVisible) {
+                int ty = UI_HEADER_HEIGHT + 10 + 150 + PROF_COUNT * 16 + 6;
+                DrawText(TextFormat("QUALITY %s (%s)  BUDGET %.1f ms%s", quality.name, governor.enabled ? "AUTO" : "FIXED", governor.budgetMs, pacer.enabled ? frameArena.Format("  DELAY %.1f ms", pacer.delay * 1e3) : ""), SCREEN_WIDTH - 330, ty, 12, V_DARKGRAY);
+                DrawText(TextFormat("RENDER %dx%d (%.0f%%)  WINDOW %dx%d", display.target.texture.width, display.target.texture.height, display.scale * 100.0f, GetRenderWidth(), GetRenderHeight()), SCREEN_WIDTH - 330, ty + 14, 12, V_DARKGRAY);
+            }
+        double presentStart = SimClock();
+            EndMode2D();
+        { ProfileScope presentScope(PROF_PRESENT); EndDrawing(); }
+        double presentEnd = SimClock();
+        // EndDrawing() swaps, polls, then (with raylib's cap) waits; without the cap the poll is its last step.
+        pollTime = (vsync || uncapped || pacer.enabled) ? presentEnd : presentStart;
+        profiler.EndFrame(gs.enemies.Size(), gs.particles.Size(), gs.lasers.Size(), latency.Presented(presentEnd, snapshot.commands));
+        if (currentScreen == GAMEPLAY) {
+            int tierBefore = governor.tier;
+            governor.Observe(profiler.Recent(0).frameMs, profiler.Recent(0).frameMs - profiler.Recent(0).stageMs[PROF_PRESENT]);
+            if (governor.tier != tierBefore) TraceLog(LOG_INFO, "QUALITY: %s -> %s", QUALITY_TIERS[tierBefore].name, QUALITY_TIERS[governor.tier].name);
+        }
+        if (telemetry) {
+            if (currentScreen == GAMEPLAY && gs.waveActive) frameTelemetry.Add(*telemetry, profiler.Recent(0), gs.powerups.Size(), gs.currentWave, gs.tick);
+            else if (!gs.waveActive) frameTelemetry.Flush(*telemetry);
+        }
+
+        // --alloc-assert: once warmed up, a GAMEPLAY frame must not allocate on any thread.
+        gameplayFrames = (currentScreen == GAMEPLAY) ? gameplayFrames + 1 : 0;
+        if (allocAssert && gameplayFrames > ALLOC_WARMUP_FRAMES && profiler.Recent(0).allocTotal > 0) {
+            const FrameRecord& r = profiler.Recent(0);
+            fprintf(stderr, "ALLOC: %llu allocations in gameplay frame %d (tick %u)\n", (unsigned long long)r.allocTotal, gameplayFrames, gs.tick);
+            for (int s = 0; ALLOC_TRACKING && s <= PROF_COUNT; s++) if (r.allocs[s]) fprintf(stderr, "  %-10s %u allocs, %u bytes\n", s ? PROFILE_STAGE_NAMES[s - 1] : "other", r.allocs[s], r.allocBytes[s]);
+            std::abort();
+        }
+    }
+
+    // --- CLEANUP ---
+    awaitScores(); // A legacy migration may still be queueing a write
+    scoreWriter.Stop();
+    sim->Stop(); delete sim;
+    if (telemetry) { frameTelemetry.Flush(*telemetry); telemetry->Stop(); delete telemetry; }
+    audio->Unload(); delete audio;
+    bloom.Unload(); display.Unload();
+    guidePanel.Unload(); leaderboardPanel.Unload(); armoryPanel.Unload(); staticLayer.Unload();
+    CloseAudioDevice(); CloseWindow();
+    return 0;
+}
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# Regenerates embedded_sounds.h from sounds/*.wav. Run from the repository root:
+#   python3 sounds/embed_sounds.py
+# Every WAV must be mono, 16-bit, 44.1 kHz; anything else is rejected rather than converted.
+import array, sys, wave
+
+SOUNDS = ["Blip", "Boom", "Shoot"]  # Same order as SOUND_PCM in main.cpp
+RATE = 44100
+PER_LINE = 16
+
+text = ("// Generated from sounds/Blip.wav, sounds/Boom.wav and sounds/Shoot.wav: the decoded\n"
+        "// 16-bit mono 44.1 kHz samples with the RIFF headers stripped. main.cpp builds its\n"
+        "// Sounds straight from these arrays, so nothing is read from disk at startup.\n"
+        "// Regenerate with: python3 sounds/embed_sounds.py\n"
+        "#pragma once\n"
+        "#include <cstdint>\n\n"
+        "const unsigned int EMBEDDED_SOUND_RATE = %d;\n" % RATE)
+for name in SOUNDS:
+    path = "sounds/%s.wav" % name
+    with wave.open(path, "rb") as w:
+        if (w.getnchannels(), w.getsampwidth(), w.getframerate()) != (1, 2, RATE):
+            sys.exit("%s: expected mono 16-bit %d Hz" % (path, RATE))
+        samples = array.array("h", w.readframes(w.getnframes()))
+    if sys.byteorder == "big": samples.byteswap() # WAV data is little-endian
+    text += "\nconst int16_t embedded%sPcm[%d] = {\n" % (name, len(samples))
+    for i in range(0, len(samples), PER_LINE):
+        text += "    " + " ".join("%d," % s for s in samples[i:i + PER_LINE]) + "\n"
+    text += "};\n"
+
+# Written only once every WAV has decoded; newline="\n" keeps the header identical on Windows
+with open("embedded_sounds.h", "w", newline="\n") as out: out.write(text)